@@ -17,11 +17,14 @@
 #include <KokkosInterface.h>
 #include <SimdInterface.h>
 #include<ScratchViews.h>
+#include <master_element/MasterElementDispatch.h>
 #include <SharedMemData.h>
 #include<CopyAndInterleave.h>
 #include<FieldTypeDef.h>
 #include <stk_mesh/base/NgpMesh.hpp>
 #include <ngp_utils/NgpFieldManager.h>
+#include <ngp_utils/NgpLoopUtils.h>
+#include <NGPInstance.h>
 
 namespace stk {
 namespace mesh {
@@ -48,7 +51,13 @@ public:
   virtual void initialize_connectivity();
   virtual void execute();
 
-  template<typename LambdaFunction>
+  /** Execute the lambda on every SIMD group of entities
+   *
+   *  AlgTraits, when provided, must describe the topology of all selected
+   *  elements; the master element metrics are then evaluated through
+   *  MasterElementDispatch instead of the virtual interface.
+   */
+  template<typename AlgTraits = void, typename LambdaFunction>
   void run_algorithm(stk::mesh::BulkData& bulk_data, LambdaFunction lambdaFunc)
   {
     stk::mesh::MetaData& meta_data = bulk_data.mesh_meta_data();
@@ -60,6 +69,8 @@ public:
     const nalu_ngp::FieldManager& fieldMgr = realm_.ngp_field_manager();
     ElemDataRequestsGPU dataNeededNGP(
       fieldMgr, dataNeededByKernels_, meta_data.get_fields().size());
+    if ((entityRank_ == stk::topology::ELEM_RANK) && realm_.metricCache_)
+      dataNeededNGP.set_metric_cache(realm_.metricCache_->device_data());
 
     const auto reqType = (entityRank_ == stk::topology::ELEM_RANK)
                            ? ElemReqType::ELEM : ElemReqType::FACE;
@@ -83,6 +94,9 @@ public:
 
     auto team_exec = sierra::nalu::get_device_team_policy(
       elem_buckets.size(), bytes_per_team, bytes_per_thread);
+    nalu_ngp::impl::NgpLoopTimer loopTimer(
+      loopName_, ngpMesh, entityRank, elem_buckets,
+      bytes_per_team, bytes_per_thread, true);
     Kokkos::parallel_for(
       team_exec, KOKKOS_LAMBDA(const sierra::nalu::DeviceTeamHandleType& team) {
         auto bktId = elem_buckets.device_get(team.league_rank());
@@ -115,16 +129,11 @@ public:
                 ngpMesh.get_nodes(entityRank, elemIndex);
               fill_pre_req_data(
                 dataNeededNGP, ngpMesh, entityRank, element,
-                *smdata.prereqData[simdElemIndex]);
+                smdata.simdPrereqData, simdElemIndex);
             }
+            clear_unused_simd_lanes(smdata.simdPrereqData, numSimdElems);
 
-#ifndef KOKKOS_ENABLE_CUDA
-            // No need to interleave on GPUs
-            copy_and_interleave(
-              smdata.prereqData, numSimdElems, smdata.simdPrereqData);
-#endif
-
-            fill_master_element_views(dataNeededNGP, smdata.simdPrereqData);
+            fill_master_element_views<AlgTraits>(dataNeededNGP, smdata.simdPrereqData);
             lambdaFunc(smdata);
           });
       });
@@ -137,6 +146,12 @@ public:
   double diagRelaxFactor_{1.0};
   unsigned nodesPerEntity_;
   int rhsSize_;
+
+  //! Loop statistics key, per equation system and topology
+  std::string loopName_;
+
+  //! Device instances of activeKernels_, reused between executions
+  nalu_ngp::NGPInstanceView<Kernel> ngpKernelView_;
 };
 
 } // namespace nalu
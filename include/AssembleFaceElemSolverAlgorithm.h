@@ -22,6 +22,8 @@
 #include <stk_mesh/base/NgpMesh.hpp>
 #include <ngp_utils/NgpFieldManager.h>
 #include <ngp_utils/NgpMEUtils.h>
+#include <ngp_utils/NgpLoopUtils.h>
+#include <NGPInstance.h>
 
 namespace stk {
 namespace mesh {
@@ -77,6 +79,9 @@ public:
 
       auto team_exec = sierra::nalu::get_device_team_policy(
         buckets.size(), bytes_per_team, bytes_per_thread);
+      nalu_ngp::impl::NgpLoopTimer loopTimer(
+        loopName_, ngpMesh, sideRank, buckets,
+        bytes_per_team, bytes_per_thread, true);
       Kokkos::parallel_for(
         team_exec, KOKKOS_LAMBDA(const sierra::nalu::DeviceTeamHandleType& team) {
           auto bktId = buckets.device_get(team.league_rank());
@@ -130,22 +135,17 @@ public:
                   elemFaceOrdinal = thisElemFaceOrdinal;
                   sierra::nalu::fill_pre_req_data(
                     faceDataNGP, ngpMesh, sideRank, face,
-                    *smdata.faceViews[simdFaceIndex]);
+                    smdata.simdFaceViews, simdFaceIndex);
                   sierra::nalu::fill_pre_req_data(
                     elemDataNGP, ngpMesh, stk::topology::ELEMENT_RANK, elems[0],
-                    *smdata.elemViews[simdFaceIndex]);
+                    smdata.simdElemViews, simdFaceIndex);
                   ++simdFaceIndex;
                 }
                 smdata.numSimdFaces = simdFaceIndex;
                 numFacesProcessed += simdFaceIndex;
 
-#ifndef KOKKOS_ENABLE_CUDA
-                // No need to interleave on GPUs
-                copy_and_interleave(
-                  smdata.faceViews, smdata.numSimdFaces, smdata.simdFaceViews);
-                copy_and_interleave(
-                  smdata.elemViews, smdata.numSimdFaces, smdata.simdElemViews);
-#endif
+                clear_unused_simd_lanes(smdata.simdFaceViews, smdata.numSimdFaces);
+                clear_unused_simd_lanes(smdata.simdElemViews, smdata.numSimdFaces);
 
                 fill_master_element_views(
                   faceDataNGP, smdata.simdFaceViews, smdata.elemFaceOrdinal);
@@ -165,6 +165,12 @@ public:
   unsigned nodesPerFace_;
   unsigned nodesPerElem_;
   int rhsSize_;
+
+  //! Loop statistics key, per equation system and face/element topology
+  std::string loopName_;
+
+  //! Device instances of activeKernels_, reused between executions
+  nalu_ngp::NGPInstanceView<Kernel> ngpKernelView_;
 };
 
 } // namespace nalu
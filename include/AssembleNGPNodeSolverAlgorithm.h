@@ -12,6 +12,7 @@
 #define ASSEMBLENGPNODESOLVERALGORITHM_H
 
 #include "SolverAlgorithm.h"
+#include "NGPInstance.h"
 
 #include <vector>
 #include <memory>
@@ -54,10 +55,22 @@ public:
     nodeKernels_.push_back(std::make_unique<T>(std::forward<Args>(args)...));
   }
 
+  /** Assemble the node kernels with the node loop specialized for KernelPack
+   *
+   *  kernelPack is either a NodeKernelPack matched to the registered kernels or
+   *  DynamicNodeKernelPack. Public only for the device lambda.
+   */
+  template<typename KernelPack, typename KernelView>
+  void run_node_kernels(
+    const KernelPack& kernelPack, const KernelView& ngpKernels);
+
 private:
   //! List of NodeKernels registered with this algorithm
   NodeKernelVecType nodeKernels_;
 
+  //! Device instances of nodeKernels_, reused between executions
+  nalu_ngp::NGPInstanceView<NodeKernel> ngpKernelView_;
+
   //! Number of DOFs per nodal entity
   const int rhsSize_;
 };
@@ -42,7 +42,6 @@ public:
 
   ScalarFieldType *scalarQ_;
   ScalarFieldType *diffFluxCoeff_;
-  VectorFieldType *coordinates_;
   GenericFieldType *exposedAreaVec_;
   GenericFieldType *ncMassFlowRate_;
 
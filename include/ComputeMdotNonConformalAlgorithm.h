@@ -40,7 +40,6 @@ public:
   VectorFieldType *Gjp_;
   VectorFieldType *velocity_;
   VectorFieldType *meshVelocity_;
-  VectorFieldType *coordinates_;
   ScalarFieldType *density_;
   GenericFieldType *exposedAreaVec_;
   GenericFieldType *ncMassFlowRate_;
@@ -90,23 +90,6 @@ void copy_and_interleave(const MultiDimViewsType ** data,
   }
 }
 
-#ifndef KOKKOS_ENABLE_CUDA
-inline
-void copy_and_interleave(std::unique_ptr<ScratchViews<double>>* data,
-                         int simdElems,
-                         ScratchViews<DoubleType>& simdData)
-{
-    MultiDimViews<DoubleType, TeamHandleType, HostShmem>& simdFieldViews = simdData.get_field_views();
-    const MultiDimViews<double, TeamHandleType, HostShmem>* fViews[stk::simd::ndoubles] = {nullptr};
-
-    for(int simdIndex=0; simdIndex<simdElems; ++simdIndex) {
-      fViews[simdIndex] = &data[simdIndex]->get_field_views();
-    }
-
-    copy_and_interleave(fViews, simdElems, simdFieldViews);
-}
-#endif
-
 KOKKOS_FUNCTION
 inline
 void extract_vector_lane(const SharedMemView<DoubleType*,DeviceShmem>& simdrhs, int simdIndex, SharedMemView<double*,DeviceShmem>& rhs)
@@ -86,6 +86,9 @@ class DgInfo {
   // search provides opposing face
   stk::mesh::Entity opposingFace_;
 
+  // global id of the opposing face; seeds the predictive search
+  uint64_t opposingFaceId_;
+
   // face:element relations provide connected element to opposing face
   stk::mesh::Entity opposingElement_;
 
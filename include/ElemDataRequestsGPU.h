@@ -16,6 +16,7 @@
 #include <Kokkos_Core.hpp>
 #include <ElemDataRequests.h>
 #include <FieldTypeDef.h>
+#include <MasterElementMetricCache.h>
 #include <stk_mesh/base/Ngp.hpp>
 #include <stk_mesh/base/GetNgpField.hpp>
 #include <ngp_utils/NgpFieldManager.h>
@@ -122,6 +123,10 @@ public:
   void add_fem_volume_me(MasterElement *meFEM)
   { meFEM_ = meFEM; }
 
+  //! Use cached master element metrics instead of recomputing them
+  void set_metric_cache(const MetricCacheData& metricCache)
+  { metricCache_ = metricCache; }
+
   KOKKOS_FUNCTION
   const DataEnumView& get_data_enums(const COORDS_TYPES cType) const
   { return dataEnums[cType]; }
@@ -165,6 +170,9 @@ public:
   KOKKOS_FUNCTION
   MasterElement *get_fem_volume_me() const {return meFEM_;}
 
+  KOKKOS_FUNCTION
+  const MetricCacheData& get_metric_cache() const { return metricCache_; }
+
 private:
   void copy_to_device();
 
@@ -192,6 +200,8 @@ private:
   MasterElement *meSCS_;
   MasterElement *meSCV_;
   MasterElement *meFEM_;
+
+  MetricCacheData metricCache_;
 };
 
 } // namespace nalu
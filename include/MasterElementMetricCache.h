@@ -0,0 +1,172 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MASTERELEMENTMETRICCACHE_H
+#define MASTERELEMENTMETRICCACHE_H
+
+#include "ElemDataRequests.h"
+#include "KokkosInterface.h"
+#include "SimdInterface.h"
+
+#include <stk_mesh/base/Types.hpp>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace YAML {
+class Node;
+}
+
+namespace sierra {
+namespace nalu {
+
+class Algorithm;
+class Realm;
+
+/** Device view of the cached master element metrics
+ *
+ *  The metrics of an element are stored contiguously in the flattened order
+ *  of the corresponding MasterElementViews member. The storage is addressed
+ *  through the element bucket: each (bucket, metric) pair has an offset into
+ *  the value array and the number of values per element. A stride of zero
+ *  marks buckets (or metrics) that are not cached.
+ */
+struct MetricCacheData
+{
+  enum Metric {
+    AREAV = 0,
+    GRAD_OP,
+    SHIFTED_GRAD_OP,
+    VOLUME,
+    NUM_METRICS
+  };
+
+  using OffsetView = Kokkos::View<int64_t**, Kokkos::LayoutRight, MemSpace>;
+  using StrideView = Kokkos::View<int**, Kokkos::LayoutRight, MemSpace>;
+  using ValueView = Kokkos::View<double*, MemSpace>;
+
+  /** Copy the cached metric of a SIMD group of elements into a view
+   *
+   *  Unused SIMD lanes receive the values of the first element so that they
+   *  hold valid geometry. Returns false, without touching the view, if any
+   *  element of the group has no cached values of the expected size.
+   */
+  template <typename ViewType>
+  KOKKOS_INLINE_FUNCTION
+  bool gather(
+    const int metric,
+    const stk::mesh::FastMeshIndex* elemIdx,
+    const int numElems,
+    ViewType& view) const
+  {
+    if (!active || numElems < 1) return false;
+
+    const int len = view.size();
+    const unsigned numBuckets = strides.extent(0);
+    for (int s = 0; s < numElems; ++s) {
+      const unsigned bktId = elemIdx[s].bucket_id;
+      if ((bktId >= numBuckets) || (strides(bktId, metric) != len))
+        return false;
+    }
+
+    auto* data = view.data();
+    for (int s = 0; s < simdLen; ++s) {
+      const auto& idx = elemIdx[(s < numElems) ? s : 0];
+      const int64_t begin = offsets(idx.bucket_id, metric) +
+        static_cast<int64_t>(idx.bucket_ord) * len;
+      for (int i = 0; i < len; ++i)
+        set_simd_lane(data[i], s, values(begin + i));
+    }
+    return true;
+  }
+
+  OffsetView offsets;
+  StrideView strides;
+  ValueView values;
+  bool active{false};
+};
+
+/** Optional cache of master element metrics for static meshes
+ *
+ *  When the mesh neither moves nor deforms, the SCS area vectors, SCS
+ *  gradient operators and SCV volumes of an element never change, yet the
+ *  assembly kernels recompute them from the nodal coordinates every time they
+ *  are invoked. This class evaluates the requested metrics once after the
+ *  geometry has been computed and stores them per element and integration
+ *  point. ElemDataRequestsGPU carries the device view of the cache into the
+ *  ScratchViews fill, which copies the cached values instead of calling the
+ *  master element.
+ *
+ *  The metrics are enabled in the order they are listed in the input file
+ *  until the memory budget is exhausted; metrics that do not fit are
+ *  computed on the fly as before.
+ *
+ *  \sa MetricCacheElemAlg
+ */
+class MasterElementMetricCache
+{
+public:
+  MasterElementMetricCache(Realm&);
+
+  ~MasterElementMetricCache();
+
+  //! Parse the `master_element_metric_cache` input block
+  void load(const YAML::Node&);
+
+  //! Register the computation of the metrics on an interior element block
+  void register_interior_algorithm(stk::mesh::Part*);
+
+  //! Evaluate and store the metrics of all locally owned elements
+  void build();
+
+  //! Device view of the cache, rebuilt first if the mesh was modified or moved
+  const MetricCacheData& device_data();
+
+  //! Mark the cached metrics as stale after the coordinates changed
+  void invalidate() { isStale_ = true; }
+
+  //! Cache data for the algorithms populating the metrics
+  const MetricCacheData& data() const { return data_; }
+
+  //! True if the metric is stored in the cache
+  bool is_cached(const MetricCacheData::Metric metric) const
+  { return enabled_[metric]; }
+
+private:
+  Realm& realm_;
+
+  //! Metrics requested in the input file, in order of priority
+  std::vector<MetricCacheData::Metric> requested_;
+
+  //! Memory available for the cache on each MPI rank
+  double memoryBudgetMB_{2048.0};
+
+  bool enabled_[MetricCacheData::NUM_METRICS] = {false, false, false, false};
+
+  //! Interior element blocks covered by the cache
+  stk::mesh::PartVector partVec_;
+
+  std::map<std::string, std::unique_ptr<Algorithm>> algMap_;
+
+  MetricCacheData data_;
+
+  //! Mesh modification count used to build the cache
+  size_t meshModCount_{0};
+
+  //! The geometry was recomputed since the cache was built
+  bool isStale_{true};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* MASTERELEMENTMETRICCACHE_H */
@@ -55,6 +55,9 @@ public:
   MaterialPropertyVector materialPropertyVector_;
   std::string propertyTableName_;
 
+  // lazy property evaluation; off if not positive
+  double lazyEvaluationTolerance_;
+
   // vectors and maps required to manage full set of options
   std::vector<std::string> targetNames_;
   std::map<std::string, double> universalConstantMap_;
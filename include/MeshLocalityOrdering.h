@@ -0,0 +1,103 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MeshLocalityOrdering_h
+#define MeshLocalityOrdering_h
+
+#include <FieldTypeDef.h>
+
+#include <stk_mesh/base/BulkData.hpp>
+#include <stk_mesh/base/EntitySorterBase.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Cache-aware ordering of the local nodes and elements
+ *
+ *  Mesh generators typically emit entities plane by plane, so that the nodes
+ *  of an element end up far apart in the STK buckets. This sorter assigns
+ *  every local node and element an ordering key and sorts the bucket
+ *  contents by it:
+ *
+ *    - `hilbert`: position along a Hilbert space-filling curve through the
+ *      node coordinates (element centroids for elements);
+ *    - `rcm`: reverse Cuthill-McKee numbering of the node graph; elements
+ *      follow their lowest numbered node.
+ *
+ *  Entities of other ranks keep their order. The node ordering is also used
+ *  for the Hypre row numbering, see Realm::set_hypre_global_id. The keys are
+ *  indexed by the local offset of the entities and are recomputed when the
+ *  mesh has been modified since they were computed.
+ */
+class MeshLocalityOrdering : public stk::mesh::EntitySorterBase
+{
+public:
+  MeshLocalityOrdering(const std::string& method);
+
+  virtual ~MeshLocalityOrdering() = default;
+
+  //! Compute the ordering keys and sort the buckets; reports node locality
+  void reorder(stk::mesh::BulkData& bulk, const VectorFieldType& coordinates);
+
+  virtual void sort(
+    stk::mesh::BulkData& bulk,
+    stk::mesh::EntityVector& entityVector) const override;
+
+  //! Sort node identifiers by their ordering key
+  void sort_node_ids(
+    const stk::mesh::BulkData& bulk,
+    std::vector<stk::mesh::EntityId>& nodeIds);
+
+  /** Maximum and mean node span of the locally owned elements
+   *
+   *  The span of an element is the distance between its first and last node
+   *  in the bucket traversal order; the mean is over all MPI ranks.
+   */
+  std::pair<int64_t, double> node_span(const stk::mesh::BulkData& bulk) const;
+
+private:
+  //! Compute the ordering keys of the current mesh
+  void compute_keys(const stk::mesh::BulkData& bulk);
+
+  void compute_hilbert_keys(
+    const stk::mesh::BulkData& bulk, const VectorFieldType& coordinates);
+
+  void compute_rcm_keys(const stk::mesh::BulkData& bulk);
+
+  //! Print the node bandwidth of the locally owned elements
+  void report_locality(
+    const stk::mesh::BulkData& bulk, const std::string& stage) const;
+
+  uint64_t key(const stk::mesh::Entity entity) const
+  {
+    const auto offset = entity.local_offset();
+    return (offset < keys_.size()) ? keys_[offset] : UINT64_MAX;
+  }
+
+  const bool useRcm_;
+
+  //! Ordering keys of nodes and elements indexed by local offset
+  std::vector<uint64_t> keys_;
+
+  //! Coordinates used for the Hilbert keys
+  const VectorFieldType* coordinates_{nullptr};
+
+  //! Mesh modification count the keys were computed for
+  size_t meshModCount_{0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
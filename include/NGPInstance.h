@@ -13,7 +13,9 @@
 
 #include "KokkosInterface.h"
 
+#include <string>
 #include <type_traits>
+#include <vector>
 
 namespace sierra {
 namespace nalu {
@@ -60,6 +62,24 @@ inline T* create(Args&&... args)
   return obj;
 }
 
+/** Replace the device instance with a copy of the host object
+ *
+ *  The instance is destroyed and copy-constructed in place, i.e., the device
+ *  memory allocated by `create` is reused.
+ */
+template<typename T>
+inline void update(T* obj, const T& hostObj)
+{
+  const std::string debuggingName(typeid(T).name());
+
+  // Create local copy for capture on device
+  const T hostCopy(hostObj);
+  Kokkos::parallel_for(debuggingName, 1, KOKKOS_LAMBDA(const int) {
+      obj->~T();
+      new (obj) T(hostCopy);
+    });
+}
+
 template<typename T>
 inline void destroy(T* obj)
 {
@@ -128,6 +148,60 @@ create_ngp_view(const Container& hostVec)
   return ngpVec;
 }
 
+/** Persistent Kokkos::View of device instances
+ *
+ *  Same as create_ngp_view, but the view is kept between calls to `update`.
+ *  The view is only reallocated when the number of instances changes, and
+ *  only copied to the device when one of the device pointers changes. Used by
+ *  the assembly algorithms which refresh the device copies of their kernels
+ *  at every execution.
+ */
+template<typename T>
+class NGPInstanceView
+{
+public:
+  using ViewType = Kokkos::View<NGPCopyHolder<T>*, Kokkos::LayoutRight, MemSpace>;
+
+  /** Refresh the device instances and return the view
+   *
+   *  Calls `create_on_device` on every host instance.
+   */
+  template<typename Container>
+  const ViewType& update(const Container& hostVec)
+  {
+    const size_t numObjects = hostVec.size();
+    bool modified = false;
+    if (devicePtrs_.size() != numObjects) {
+      const std::string clsName(typeid(T).name());
+      ngpVec_ = ViewType("NGP" + clsName + "View", numObjects);
+      hostNgpVec_ = Kokkos::create_mirror_view(ngpVec_);
+      devicePtrs_.assign(numObjects, nullptr);
+      modified = true;
+    }
+
+    for (size_t i=0; i < numObjects; ++i) {
+      T* devicePtr = hostVec[i]->create_on_device();
+      if (devicePtr != devicePtrs_[i]) {
+        devicePtrs_[i] = devicePtr;
+        hostNgpVec_(i) = NGPCopyHolder<T>(devicePtr);
+        modified = true;
+      }
+    }
+
+    if (modified)
+      Kokkos::deep_copy(ngpVec_, hostNgpVec_);
+
+    return ngpVec_;
+  }
+
+private:
+  ViewType ngpVec_;
+  typename ViewType::HostMirror hostNgpVec_;
+
+  //! Device pointers currently stored in the view
+  std::vector<T*> devicePtrs_;
+};
+
 } // nalu_ngp
 
 }  // nalu
@@ -0,0 +1,207 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NONCONFORMALDEVICEDATA_H
+#define NONCONFORMALDEVICEDATA_H
+
+#include "FieldTypeDef.h"
+#include "KokkosInterface.h"
+#include "SolverAlgorithm.h"
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <string>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+class NonConformalInfo;
+
+/** Flattened DG data of all non-conformal interfaces for device kernels
+ *
+ *  Each entry corresponds to one DgInfo, i.e., one Gauss point on a current
+ *  face together with its located opposing face. The interpolation weights
+ *  at the current and opposing iso-parametric coordinates are evaluated once
+ *  per search on host, so device kernels only need the node indices and
+ *  weights stored in compressed row format.
+ *
+ *  The face gradient operators of the current and opposing elements are
+ *  evaluated on host as well, at the element coordinates of each point
+ *  (sidePcoords_to_elemPcoords followed by general_face_grad_op), since the
+ *  device master elements do not provide them at arbitrary points. The mesh
+ *  is searched again after every mesh motion, so they follow the current
+ *  coordinates.
+ */
+class NonConformalDeviceData
+{
+public:
+  using IntView = Kokkos::View<int*, MemSpace>;
+  using DblView = Kokkos::View<double*, MemSpace>;
+  using MeshIndexView = Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace>;
+
+  NonConformalDeviceData(stk::mesh::BulkData& bulk) : bulk_(bulk) {}
+
+  //! Rebuild the flattened data after a new non-conformal search
+  void build(
+    const std::vector<NonConformalInfo*>& infoVec,
+    const VectorFieldType& coordinates);
+
+  //! Recompute the device mesh indices if the mesh was modified
+  void update_mesh_indices();
+
+  //! Number of Gauss points on this rank
+  int num_points() const { return numPoints_; }
+
+  //! Largest number of current and opposing element nodes of a point
+  int max_elem_nodes() const { return maxElemNodes_; }
+
+  /** Assemble the DG contribution of every point to the linear system
+   *
+   *  The rows and columns are the current element nodes followed by the
+   *  opposing element nodes of a point. The functor is called as
+   *  `f(ip, numNodes, rhs, lhs)` with zeroed rhs and lhs of size
+   *  numNodes*numDof, which are then summed into the linear system.
+   */
+  template <typename AssembleFunctor>
+  void assemble(
+    const std::string& name,
+    const NGPApplyCoeff& coeffApplier,
+    const int numDof,
+    const AssembleFunctor& f) const;
+
+  //! Current face and Gauss point ordinal of each point
+  MeshIndexView currentFace_;
+  IntView gaussPointId_;
+
+  //! Nearest node of each point on the current face
+  MeshIndexView nearestNode_;
+
+  //! Current face nodes and interpolation weights of each point
+  IntView currentOffsets_;
+  MeshIndexView currentNodes_;
+  DblView currentWeights_;
+
+  //! Opposing face nodes and interpolation weights of each point
+  IntView opposingOffsets_;
+  MeshIndexView opposingNodes_;
+  DblView opposingWeights_;
+
+  //! Element ordinal of each current and opposing face node
+  IntView currentFaceElemOrdinals_;
+  IntView opposingFaceElemOrdinals_;
+
+  /** Current and opposing element nodes of each point
+   *
+   *  The current element nodes of point ip are in [elemOffsets_(2*ip),
+   *  elemOffsets_(2*ip+1)), the opposing ones in [elemOffsets_(2*ip+1),
+   *  elemOffsets_(2*ip+2)). The face gradient operator has nDim entries per
+   *  element node.
+   */
+  IntView elemOffsets_;
+  MeshIndexView elemNodes_;
+  Kokkos::View<stk::mesh::Entity*, MemSpace> elemEntities_;
+  DblView elemDndx_;
+
+  //! Current element ordinal of the nearest node of each point
+  IntView nearestElemNode_;
+
+  //! Unit normal of the opposing face at each point
+  DblView opposingNormal_;
+
+private:
+  stk::mesh::BulkData& bulk_;
+
+  int numPoints_{0};
+  int maxElemNodes_{0};
+
+  //! Host entities backing the device mesh indices
+  std::vector<stk::mesh::Entity> h_currentFace_;
+  std::vector<stk::mesh::Entity> h_nearestNode_;
+  std::vector<stk::mesh::Entity> h_currentNodes_;
+  std::vector<stk::mesh::Entity> h_opposingNodes_;
+  std::vector<stk::mesh::Entity> h_elemNodes_;
+
+  //! Mesh modification count used to build the device mesh indices
+  size_t meshModCount_{0};
+  bool meshIndicesValid_{false};
+};
+
+template <typename AssembleFunctor>
+void
+NonConformalDeviceData::assemble(
+  const std::string& name,
+  const NGPApplyCoeff& coeffApplier,
+  const int numDof,
+  const AssembleFunctor& f) const
+{
+  // points are assembled in chunks, one thread per point
+  const int pointsPerTeam = 32;
+  const int numPoints = numPoints_;
+  const int numTeams = (numPoints + pointsPerTeam - 1) / pointsPerTeam;
+
+  const int maxRows = maxElemNodes_ * numDof;
+  const int bytes_per_thread =
+    (maxRows * (1 + maxRows)) * sizeof(double) + 2 * maxRows * sizeof(int);
+  auto team_exec = get_device_team_policy(numTeams, 0, bytes_per_thread);
+
+  const auto elemOffsets = elemOffsets_;
+  const auto elemEntities = elemEntities_;
+
+  Kokkos::parallel_for(
+    name, team_exec, KOKKOS_LAMBDA(const DeviceTeamHandleType& team) {
+      auto rhsData =
+        get_shmem_view_1D<double, DeviceTeamHandleType, DeviceShmem>(
+          team, maxRows);
+      auto lhsData =
+        get_shmem_view_1D<double, DeviceTeamHandleType, DeviceShmem>(
+          team, maxRows * maxRows);
+      auto scratchIds =
+        get_shmem_view_1D<int, DeviceTeamHandleType, DeviceShmem>(
+          team, maxRows);
+      auto sortPermutation =
+        get_shmem_view_1D<int, DeviceTeamHandleType, DeviceShmem>(
+          team, maxRows);
+
+      const int begin = team.league_rank() * pointsPerTeam;
+      const int end =
+        (begin + pointsPerTeam < numPoints) ? begin + pointsPerTeam : numPoints;
+      Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, begin, end), [&](const int ip) {
+          const int elemBegin = elemOffsets(2 * ip);
+          const int numNodes = elemOffsets(2 * ip + 2) - elemBegin;
+          const int numRows = numNodes * numDof;
+
+          SharedMemView<double*, DeviceShmem> rhs(rhsData.data(), numRows);
+          SharedMemView<double**, DeviceShmem> lhs(
+            lhsData.data(), numRows, numRows);
+          set_vals(rhs, 0.0);
+          set_vals(lhs, 0.0);
+
+          f(ip, numNodes, rhs, lhs);
+
+          const stk::mesh::NgpMesh::ConnectedNodes nodes(
+            &elemEntities(elemBegin), numNodes);
+          coeffApplier(
+            numNodes, nodes, scratchIds, sortPermutation, rhs, lhs, __FILE__);
+        });
+    });
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* NONCONFORMALDEVICEDATA_H */
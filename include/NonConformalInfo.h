@@ -75,6 +75,7 @@ class NonConformalInfo {
     const bool clipIsoParametricCoords,
     const double searchTolerance,
     const bool   dynamicSearchTolAlg,
+    const bool   predictiveSearch,
     const std::string debugName);
 
   ~NonConformalInfo();
@@ -91,6 +92,7 @@ class NonConformalInfo {
   void reset_dgInfo();
   void construct_bounding_points();
   void construct_bounding_boxes();
+  void predict_opposing_faces();
   void determine_elems_to_ghost();
   void complete_search();
   void provide_diagnosis();
@@ -117,6 +119,9 @@ class NonConformalInfo {
   /* allow for dynamic search tolerance algorithm where search tolerance is used as point radius from isInElem */
   const bool dynamicSearchTolAlg_;
 
+  /* seed the search with the previous opposing face and walk across neighbors */
+  const bool predictiveSearch_;
+
   /* does the realm have mesh motion */
   const bool meshMotion_;
 
@@ -133,11 +138,18 @@ class NonConformalInfo {
   /* save off product of search */
   std::vector<std::pair<theKey, theKey> > searchKeyPair_;
 
+  /* ghosted opposing faces found by the predictive search; the owners must keep them ghosted */
+  std::vector<stk::mesh::Entity> predictedGhostFaces_;
+
   private :
   void delete_range_points_found(std::vector<boundingSphere>                 &boundingSphereVec,
                                  const std::vector<std::pair<theKey,theKey>> &searchKeyPair) const;
   void repeat_search_if_needed  (const std::vector<boundingSphere>           &boundingSphereVec,
                                  std::vector<std::pair<theKey,theKey>>       &searchKeyPair) const;
+  double opposing_face_distance(stk::mesh::Entity face,
+                                const std::vector<double> &pointCoords,
+                                std::vector<double> &isoParCoords) const;
+  void request_predicted_ghosts();
 };
 
 } // end sierra namespace
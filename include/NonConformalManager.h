@@ -20,6 +20,7 @@
 #include <stk_mesh/base/Part.hpp>
 #include <stk_mesh/base/Ghosting.hpp>
 
+#include <memory>
 #include <vector>
 #include <map>
 
@@ -29,6 +30,7 @@ namespace nalu {
 class DgInfo;
 class Realm;
 class NonConformalInfo;
+class NonConformalDeviceData;
 
 //=============================================================================
 // Class Definition
@@ -57,6 +59,11 @@ class NonConformalManager {
 
   void initialize();
 
+  /* communicate fields to the ghosted entities; the ghosting is host-only,
+     so the fields are synchronized to host and marked modified there */
+  void communicate_ghosted_fields(
+    const std::vector<const stk::mesh::FieldBase*>& fieldVec);
+
   Realm &realm_;
   const bool ncAlgDetailedOutput_;
   const bool ncAlgCoincidentNodesErrorCheck_;
@@ -69,6 +76,12 @@ class NonConformalManager {
 
   std::vector<int> ghostCommProcs_;
 
+  /* true if any rank exchanges ghosted entities */
+  bool hasGhostComm_{false};
+
+  /* flattened DgInfo data of all interfaces for device algorithms */
+  std::unique_ptr<NonConformalDeviceData> deviceData_;
+
   private:
 
   void manage_ghosting(std::vector<stk::mesh::EntityKey>& recvGhostsToRemove);
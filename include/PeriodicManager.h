@@ -77,11 +77,24 @@ class PeriodicManager {
     const bool &setSlaves = true,
     const bool &doCommunication = true) const;
 
+  // batched master += slave; slave = master with one communication per stage
+  void ngp_apply_constraints(
+    const std::vector<stk::mesh::FieldBase*> &,
+    const std::vector<unsigned> &sizeOfFields,
+    const bool &bypassFieldCheck,
+    const bool &addSlaves = true,
+    const bool &setSlaves = true,
+    const bool &doCommunication = true) const;
+
   // find the max
   void apply_max_field(
     stk::mesh::FieldBase *,
     const unsigned &sizeOfField);
 
+  void ngp_apply_max_field(
+    stk::mesh::FieldBase *,
+    const unsigned &sizeOfField) const;
+
   void manage_ghosting_object();
 
   stk::mesh::Ghosting * get_ghosting_object();
@@ -113,7 +126,15 @@ class PeriodicManager {
     stk::mesh::Selector masterSelector,
     stk::mesh::Selector slaveSelector,
     std::vector<double> &translationVector,
-    const stk::search::SearchMethod searchMethod);
+    const stk::search::SearchMethod searchMethod,
+    const bool sortedMatch = false);
+
+  // match translated slave nodes to master nodes by sorting quantized coordinates
+  void sorted_match_search_key_vec(
+    stk::mesh::Selector masterSelector,
+    stk::mesh::Selector slaveSelector,
+    std::vector<double> &translationVector,
+    std::vector<stk::mesh::EntityKey> &matchedSlaves);
 
   void error_check();
 
@@ -161,6 +182,12 @@ class PeriodicManager {
 
   std::vector<int> ghostCommProcs_;
 
+  //! Slave and master node pairs found by the search
+  const SearchKeyVector& get_search_key_vector() const
+  {
+    return searchKeyVector_;
+  }
+
   void ngp_add_slave_to_master(
     stk::mesh::FieldBase *theField,
     const unsigned &sizeOfField,
@@ -186,6 +213,9 @@ class PeriodicManager {
   // vector of search types
   std::vector<stk::search::SearchMethod> searchMethodVec_;
 
+  // pairs matched by sorting quantized coordinates before the coarse search
+  std::vector<bool> sortedMatchVec_;
+
   // translation and rotation
   std::vector<std::vector<double> > translationVector_;
   std::vector<std::vector<double> > rotationVector_;
@@ -208,6 +238,25 @@ class PeriodicManager {
     const unsigned &sizeOfField,
     const bool &bypassFieldCheck);
 
+  void add_slave_to_master_on_device(
+    NGPDoubleFieldType &ngpField,
+    const unsigned &sizeOfField,
+    const bool &bypassFieldCheck) const;
+
+  void set_slave_to_master_on_device(
+    NGPDoubleFieldType &ngpField,
+    const unsigned &sizeOfField,
+    const bool &bypassFieldCheck) const;
+
+  std::vector<NGPDoubleFieldType*> get_ngp_double_fields(
+    const std::vector<stk::mesh::FieldBase*> &fields) const;
+
+  void ngp_periodic_parallel_communicate_fields(
+    const std::vector<NGPDoubleFieldType*> &ngpFields) const;
+
+  void ngp_parallel_communicate_fields(
+    const std::vector<NGPDoubleFieldType*> &ngpFields) const;
+
 };
 
 } // namespace nalu
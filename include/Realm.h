@@ -59,6 +59,8 @@ class Algorithm;
 class AlgorithmDriver;
 class AuxFunctionAlgorithm;
 class GeometryAlgDriver;
+class MasterElementMetricCache;
+class MeshLocalityOrdering;
 
 class NonConformalManager;
 class ErrorIndicatorAlgorithmDriver;
@@ -241,10 +243,31 @@ class Realm {
     const unsigned &sizeOfTheField,
     const bool &bypassFieldCheck = true) const;
 
+  // batched update of fields assembled on host; the constraints are applied
+  // on device and the result is synced back to host
+  void periodic_field_update(
+    const std::vector<stk::mesh::FieldBase*> &fields,
+    const std::vector<unsigned> &sizeOfFields,
+    const bool &bypassFieldCheck = true) const;
+
   void periodic_field_max(
     stk::mesh::FieldBase *theField,
     const unsigned &sizeOfTheField) const;
 
+  void ngp_periodic_field_update(
+    stk::mesh::FieldBase *theField,
+    const unsigned &sizeOfTheField,
+    const bool &bypassFieldCheck = true) const;
+
+  void ngp_periodic_field_update(
+    const std::vector<stk::mesh::FieldBase*> &fields,
+    const std::vector<unsigned> &sizeOfFields,
+    const bool &bypassFieldCheck = true) const;
+
+  void ngp_periodic_field_max(
+    stk::mesh::FieldBase *theField,
+    const unsigned &sizeOfTheField) const;
+
   void periodic_delta_solution_update(
      stk::mesh::FieldBase *theField,
      const unsigned &sizeOfField,
@@ -428,6 +451,9 @@ class Realm {
 
   // algorithm drivers managed by region
   std::unique_ptr<GeometryAlgDriver> geometryAlgDriver_;
+
+  //! Optional cache of master element metrics for static meshes
+  std::unique_ptr<MasterElementMetricCache> metricCache_;
   unsigned numInitialElements_;
 
 
@@ -477,6 +503,10 @@ class Realm {
   double timerNonconformal_;
   double timerInitializeEqs_;
   double timerPropertyEval_;
+
+  // lazy property evaluation; nodes evaluated and skipped in this time step
+  size_t lazyPropNodesEvaluated_{0};
+  size_t lazyPropNodesSkipped_{0};
   double timerTransferSearch_;
   double timerTransferExecute_;
   double timerSkinMesh_;
@@ -528,6 +558,10 @@ class Realm {
   bool rebalanceMesh_{false};
   
   std::string rebalanceMethod_;
+
+  // cache-aware ordering of nodes and elements; none, hilbert or rcm
+  std::string meshReordering_{"none"};
+  std::unique_ptr<MeshLocalityOrdering> localityOrdering_;
    
   // allow aura to be optional
   bool activateAura_;
@@ -685,6 +719,11 @@ class Realm {
    */
   bool hypreIsActive_{false};
 
+  /** Flag indicating that periodic slave nodes share the Hypre row of their
+   * master node instead of owning an identity row.
+   */
+  bool foldPeriodicRows_{false};
+
   std::vector<std::string> handle_all_element_part_alias(const std::vector<std::string>& names) const;
 
 protected:
@@ -31,6 +31,8 @@
 namespace sierra{
 namespace nalu{
 
+template <typename AlgTraits> struct MasterElementDispatch;
+
 template<typename FieldInfoViewType>
 KOKKOS_INLINE_FUNCTION
 NumNeededViews count_needed_field_views(const FieldInfoViewType& neededFields)
@@ -101,6 +103,33 @@ public:
     MasterElement* meSCV,
     MasterElement* meFEM);
 
+  /** Copy the requested metrics that are available in the metric cache
+   *
+   *  Returns a bit mask of the ELEM_DATA_NEEDED entries that were filled, to
+   *  be skipped by fill_master_element_views_new_me.
+   */
+  KOKKOS_FUNCTION
+  unsigned fill_cached_meviews(
+    const ElemDataRequestsGPU::DataEnumView& dataEnums,
+    const MetricCacheData& cache,
+    const stk::mesh::FastMeshIndex* elemIdx,
+    int numElems);
+
+  /** Evaluate the requested CVFEM metrics without virtual dispatch
+   *
+   *  The master elements must be those of the topology described by
+   *  AlgTraits. Returns a bit mask of the ELEM_DATA_NEEDED entries that were
+   *  filled, to be skipped by fill_master_element_views_new_me.
+   */
+  template <typename AlgTraits>
+  KOKKOS_FUNCTION
+  unsigned fill_dispatched_meviews(
+    const ElemDataRequestsGPU::DataEnumView& dataEnums,
+    SharedMemView<DoubleType**, SHMEM>* coordsView,
+    MasterElement* meSCS,
+    MasterElement* meSCV,
+    unsigned filledMask = 0);
+
   void fill_master_element_views_new_me(
     const ElemDataRequestsGPU::DataEnumView& dataEnums,
     SharedMemView<double**, SHMEM>* coordsView,
@@ -108,7 +137,8 @@ public:
     MasterElement* meSCS,
     MasterElement* meSCV,
     MasterElement* meFEM,
-    int faceOrdinal = 0);
+    int faceOrdinal = 0,
+    unsigned filledMask = 0);
 
   KOKKOS_FUNCTION
   void fill_master_element_views_new_me(
@@ -118,7 +148,8 @@ public:
     MasterElement* meSCS,
     MasterElement* meSCV,
     MasterElement* meFEM,
-    int faceOrdinal = 0);
+    int faceOrdinal = 0,
+    unsigned filledMask = 0);
 
   SharedMemView<T**, SHMEM> fc_areav;
   SharedMemView<T**, SHMEM> scs_areav;
@@ -257,6 +288,10 @@ public:
 
   stk::mesh::NgpMesh::ConnectedNodes elemNodes;
 
+  //! Mesh index of the entity gathered into each SIMD lane
+  stk::mesh::FastMeshIndex simdEntityIndex[simdLen];
+  int numSimdEntities{0};
+
   KOKKOS_INLINE_FUNCTION
         MultiDimViews<T,TEAMHANDLETYPE,SHMEM>& get_field_views()       { return fieldViews; }
   KOKKOS_INLINE_FUNCTION
@@ -553,7 +588,8 @@ void MasterElementViews<T, TEAMHANDLETYPE, SHMEM>::fill_master_element_views_new
   MasterElement* meSCS,
   MasterElement* meSCV,
   MasterElement* meFEM,
-  int /* faceOrdinal */)
+  int /* faceOrdinal */,
+  unsigned /* filledMask */)
 {
   // Guard against calling MasterElement methods on SIMD data structures
   static_assert(std::is_same<T, double>::value,
@@ -686,10 +722,14 @@ void MasterElementViews<T, TEAMHANDLETYPE, SHMEM>::fill_master_element_views_new
   MasterElement* meSCS,
   MasterElement* meSCV,
   MasterElement* meFEM,
-  int faceOrdinal
+  int faceOrdinal,
+  unsigned filledMask
   )
 {
   for(unsigned i=0; i<dataEnums.size(); ++i) {
+    // skip the views already filled from the metric cache or by static dispatch
+    if (filledMask & (1u << dataEnums(i))) continue;
+
     switch(dataEnums(i))
     {
       case FC_AREAV:
@@ -766,6 +806,104 @@ void MasterElementViews<T, TEAMHANDLETYPE, SHMEM>::fill_master_element_views_new
   }
 }
 
+template<typename T, typename TEAMHANDLETYPE, typename SHMEM>
+unsigned MasterElementViews<T, TEAMHANDLETYPE, SHMEM>::fill_cached_meviews(
+  const ElemDataRequestsGPU::DataEnumView& dataEnums,
+  const MetricCacheData& cache,
+  const stk::mesh::FastMeshIndex* elemIdx,
+  int numElems)
+{
+  unsigned cachedMask = 0;
+  for(unsigned i=0; i<dataEnums.size(); ++i) {
+    bool isCached = false;
+    switch(dataEnums(i))
+    {
+      case SCS_AREAV:
+        isCached = cache.gather(MetricCacheData::AREAV, elemIdx, numElems, scs_areav);
+        break;
+      case SCS_GRAD_OP:
+        isCached = cache.gather(MetricCacheData::GRAD_OP, elemIdx, numElems, dndx);
+        break;
+      case SCS_SHIFTED_GRAD_OP:
+        isCached = cache.gather(MetricCacheData::SHIFTED_GRAD_OP, elemIdx, numElems, dndx_shifted);
+        break;
+      case SCV_VOLUME:
+        isCached = cache.gather(MetricCacheData::VOLUME, elemIdx, numElems, scv_volume);
+        break;
+      default: break;
+    }
+    if (isCached)
+      cachedMask |= (1u << dataEnums(i));
+  }
+  return cachedMask;
+}
+
+template<typename T, typename TEAMHANDLETYPE, typename SHMEM>
+template<typename AlgTraits>
+unsigned MasterElementViews<T, TEAMHANDLETYPE, SHMEM>::fill_dispatched_meviews(
+  const ElemDataRequestsGPU::DataEnumView& dataEnums,
+  SharedMemView<DoubleType**, SHMEM>* coordsView,
+  MasterElement* meSCS,
+  MasterElement* meSCV,
+  unsigned filledMask)
+{
+  using MEDispatch = MasterElementDispatch<AlgTraits>;
+
+  unsigned dispatchedMask = 0;
+  for(unsigned i=0; i<dataEnums.size(); ++i) {
+    if (filledMask & (1u << dataEnums(i))) continue;
+
+    // requests without a master element are left to the virtual fill, which
+    // reports the error
+    bool isFilled = true;
+    switch(dataEnums(i))
+    {
+      case SCS_AREAV:
+        if (meSCS == nullptr) { isFilled = false; break; }
+        MEDispatch::scs_determinant(meSCS, *coordsView, scs_areav);
+        break;
+      case SCS_GRAD_OP:
+        if (meSCS == nullptr) { isFilled = false; break; }
+        MEDispatch::scs_grad_op(meSCS, *coordsView, dndx, deriv);
+        break;
+      case SCS_SHIFTED_GRAD_OP:
+        if (meSCS == nullptr) { isFilled = false; break; }
+        MEDispatch::scs_shifted_grad_op(meSCS, *coordsView, dndx_shifted, deriv);
+        break;
+      case SCS_GIJ:
+        if (meSCS == nullptr) { isFilled = false; break; }
+        MEDispatch::scs_gij(meSCS, *coordsView, gijUpper, gijLower, deriv);
+        break;
+      case SCS_MIJ:
+        if (meSCS == nullptr) { isFilled = false; break; }
+        MEDispatch::scs_mij(meSCS, *coordsView, metric, deriv);
+        break;
+      case SCV_MIJ:
+        if (meSCV == nullptr) { isFilled = false; break; }
+        MEDispatch::scv_mij(meSCV, *coordsView, metric, deriv_scv);
+        break;
+      case SCV_VOLUME:
+        if (meSCV == nullptr) { isFilled = false; break; }
+        MEDispatch::scv_determinant(meSCV, *coordsView, scv_volume);
+        break;
+      case SCV_GRAD_OP:
+        if (meSCV == nullptr) { isFilled = false; break; }
+        MEDispatch::scv_grad_op(meSCV, *coordsView, dndx_scv, deriv_scv);
+        break;
+      case SCV_SHIFTED_GRAD_OP:
+        if (meSCV == nullptr) { isFilled = false; break; }
+        MEDispatch::scv_shifted_grad_op(meSCV, *coordsView, dndx_scv_shifted, deriv_scv);
+        break;
+      default:
+        isFilled = false;
+        break;
+    }
+    if (isFilled)
+      dispatchedMask |= (1u << dataEnums(i));
+  }
+  return dispatchedMask;
+}
+
 template<typename T,typename TEAMHANDLETYPE,typename SHMEM>
 ScratchViews<T,TEAMHANDLETYPE,SHMEM>::ScratchViews(const TEAMHANDLETYPE& team,
              unsigned nDim,
@@ -847,7 +985,94 @@ void fill_pre_req_data(const ElemDataRequestsGPU& dataNeeded,
                        stk::mesh::Entity elem,
                        ScratchViews<T,DeviceTeamHandleType,DeviceShmem>& prereqData);
 
-template<typename ELEMDATAREQUESTSTYPE,typename SCRATCHVIEWSTYPE>
+/** Gather the element data of one entity directly into a SIMD lane
+ *
+ *  Writes the field values of the entity into lane simdIndex of the
+ *  interleaved DoubleType views, so that no per-entity double ScratchViews
+ *  and copy_and_interleave pass are needed.
+ */
+KOKKOS_FUNCTION
+void fill_pre_req_data(const ElemDataRequestsGPU& dataNeeded,
+                       const stk::mesh::NgpMesh& ngpMesh,
+                       stk::mesh::EntityRank entityRank,
+                       stk::mesh::Entity elem,
+                       ScratchViews<DoubleType,DeviceTeamHandleType,DeviceShmem>& simdPrereqData,
+                       int simdIndex);
+
+//! Zero the SIMD lanes [numSimdElems, simdLen) of the gathered field data
+//! and record the number of gathered entities
+KOKKOS_FUNCTION
+void clear_unused_simd_lanes(ScratchViews<DoubleType,DeviceTeamHandleType,DeviceShmem>& simdPrereqData,
+                             int numSimdElems);
+
+namespace impl {
+
+/** Select the static dispatch of the master element metrics
+ *
+ *  Only available for SIMD scratch views of a known topology; all other
+ *  combinations leave the work to the virtual interface.
+ */
+template<typename AlgTraits, typename T>
+struct DispatchMasterElementViews
+{
+  template<typename MEViewsType, typename CoordsViewType>
+  KOKKOS_INLINE_FUNCTION
+  static unsigned fill(
+    MEViewsType&,
+    const ElemDataRequestsGPU::DataEnumView&,
+    CoordsViewType*,
+    MasterElement*,
+    MasterElement*,
+    unsigned)
+  {
+    return 0;
+  }
+};
+
+template<typename AlgTraits>
+struct DispatchMasterElementViews<AlgTraits, DoubleType>
+{
+  template<typename MEViewsType, typename CoordsViewType>
+  KOKKOS_INLINE_FUNCTION
+  static unsigned fill(
+    MEViewsType& meData,
+    const ElemDataRequestsGPU::DataEnumView& dataEnums,
+    CoordsViewType* coordsView,
+    MasterElement* meSCS,
+    MasterElement* meSCV,
+    unsigned filledMask)
+  {
+    if (coordsView == nullptr) return 0;
+    return meData.template fill_dispatched_meviews<AlgTraits>(
+      dataEnums, coordsView, meSCS, meSCV, filledMask);
+  }
+};
+
+template<>
+struct DispatchMasterElementViews<void, DoubleType>
+{
+  template<typename MEViewsType, typename CoordsViewType>
+  KOKKOS_INLINE_FUNCTION
+  static unsigned fill(
+    MEViewsType&,
+    const ElemDataRequestsGPU::DataEnumView&,
+    CoordsViewType*,
+    MasterElement*,
+    MasterElement*,
+    unsigned)
+  {
+    return 0;
+  }
+};
+
+} // namespace impl
+
+/** Fill the master element views requested by the algorithms
+ *
+ *  With AlgTraits the CVFEM metrics are evaluated through
+ *  MasterElementDispatch; the default (void) uses the virtual interface.
+ */
+template<typename AlgTraits = void, typename ELEMDATAREQUESTSTYPE, typename SCRATCHVIEWSTYPE>
 KOKKOS_FUNCTION
 void fill_master_element_views(ELEMDATAREQUESTSTYPE& dataNeeded,
                                SCRATCHVIEWSTYPE& prereqData,
@@ -868,7 +1093,19 @@ void fill_master_element_views(ELEMDATAREQUESTSTYPE& dataNeeded,
       auto* coordsView = &prereqData.get_scratch_view_2D(coordField.get_ordinal());
       auto& meData = prereqData.get_me_views(cType);
 
-      meData.fill_master_element_views_new_me(dataEnums, coordsView, meFC, meSCS, meSCV, meFEM, faceOrdinal);
+      // Metrics of static meshes are copied from the cache when available
+      unsigned cachedMask = 0;
+      const auto& metricCache = dataNeeded.get_metric_cache();
+      if (metricCache.active && prereqData.numSimdEntities > 0)
+        cachedMask = meData.fill_cached_meviews(
+          dataEnums, metricCache, prereqData.simdEntityIndex,
+          prereqData.numSimdEntities);
+
+      cachedMask |= impl::DispatchMasterElementViews<
+        AlgTraits, typename SCRATCHVIEWSTYPE::value_type>::fill(
+        meData, dataEnums, coordsView, meSCS, meSCV, cachedMask);
+
+      meData.fill_master_element_views_new_me(dataEnums, coordsView, meFC, meSCS, meSCV, meFEM, faceOrdinal, cachedMask);
     }
 }
 
@@ -891,14 +1128,15 @@ calculate_shared_mem_bytes_per_thread(
   const ELEMDATAREQUESTSTYPE& dataNeededByKernels,
   const ElemReqType reqType = ElemReqType::ELEM)
 {
-  int bytes_per_thread =
-    (rhsSize + lhsSize) * sizeof(double) + (2 * scratchIdsSize) * sizeof(int) +
-    get_num_bytes_pre_req_data<double>(dataNeededByKernels, nDim, reqType) +
-    MultiDimViews<double>::bytes_needed(
-      dataNeededByKernels.get_total_num_fields(),
-      count_needed_field_views(dataNeededByKernels.get_host_fields()));
-
-  bytes_per_thread *= 2 * simdLen;
+  // SIMD and non-SIMD versions of the LHS/RHS, but only the SIMD version of
+  // the gathered element data
+  const int bytes_per_thread =
+    ((rhsSize + lhsSize) * sizeof(double) + (2 * scratchIdsSize) * sizeof(int)) * 2 * simdLen +
+    (get_num_bytes_pre_req_data<double>(dataNeededByKernels, nDim, reqType) +
+     MultiDimViews<double>::bytes_needed(
+       dataNeededByKernels.get_total_num_fields(),
+       count_needed_field_views(dataNeededByKernels.get_host_fields()))) * simdLen;
+
   return bytes_per_thread;
 }
 
@@ -923,20 +1161,19 @@ calculate_shared_mem_bytes_per_thread(
   const ELEMDATAREQUESTSTYPE& faceDataNeeded,
   const ELEMDATAREQUESTSTYPE& elemDataNeeded)
 {
-  int bytes_per_thread =
-    (rhsSize + lhsSize) * sizeof(double) + (2 * scratchIdsSize) * sizeof(int) +
-    sierra::nalu::get_num_bytes_pre_req_data<double>(
-      faceDataNeeded, nDim, ElemReqType::FACE) +
-    sierra::nalu::get_num_bytes_pre_req_data<double>(
-      elemDataNeeded, nDim, ElemReqType::FACE_ELEM) +
-    MultiDimViews<double>::bytes_needed(
-      faceDataNeeded.get_total_num_fields(),
-      count_needed_field_views(faceDataNeeded.get_host_fields())) +
-    MultiDimViews<double>::bytes_needed(
-      elemDataNeeded.get_total_num_fields(),
-      count_needed_field_views(elemDataNeeded.get_host_fields()));
-
-  bytes_per_thread *= 2 * simdLen;
+  const int bytes_per_thread =
+    ((rhsSize + lhsSize) * sizeof(double) + (2 * scratchIdsSize) * sizeof(int)) * 2 * simdLen +
+    (sierra::nalu::get_num_bytes_pre_req_data<double>(
+       faceDataNeeded, nDim, ElemReqType::FACE) +
+     sierra::nalu::get_num_bytes_pre_req_data<double>(
+       elemDataNeeded, nDim, ElemReqType::FACE_ELEM) +
+     MultiDimViews<double>::bytes_needed(
+       faceDataNeeded.get_total_num_fields(),
+       count_needed_field_views(faceDataNeeded.get_host_fields())) +
+     MultiDimViews<double>::bytes_needed(
+       elemDataNeeded.get_total_num_fields(),
+       count_needed_field_views(elemDataNeeded.get_host_fields()))) * simdLen;
+
   return bytes_per_thread;
 }
 
@@ -33,13 +33,6 @@ struct SharedMemData {
          unsigned rhsSize)
      : simdPrereqData(team, nDim, nodesPerEntity, dataNeededByKernels)
     {
-#ifndef KOKKOS_ENABLE_CUDA
-        for(int simdIndex=0; simdIndex<simdLen; ++simdIndex) {
-          prereqData[simdIndex] = std::unique_ptr<ScratchViews<double,TEAMHANDLETYPE,SHMEM> >(new ScratchViews<double,TEAMHANDLETYPE,SHMEM>(team, nDim, nodesPerEntity, dataNeededByKernels));
-        }
-#else
-        prereqData[0] = &simdPrereqData;
-#endif
         simdrhs = get_shmem_view_1D<DoubleType,TEAMHANDLETYPE,SHMEM>(team, rhsSize);
         simdlhs = get_shmem_view_2D<DoubleType,TEAMHANDLETYPE,SHMEM>(team, rhsSize, rhsSize);
         rhs = get_shmem_view_1D<double,TEAMHANDLETYPE,SHMEM>(team, rhsSize);
@@ -56,11 +49,7 @@ struct SharedMemData {
 
     stk::mesh::NgpMesh::ConnectedNodes ngpElemNodes[simdLen];
     int numSimdElems;
-#ifdef KOKKOS_ENABLE_CUDA
-    ScratchViews<DoubleType,TEAMHANDLETYPE,SHMEM>* prereqData[1];
-#else
-    std::unique_ptr<ScratchViews<double,TEAMHANDLETYPE,SHMEM>> prereqData[simdLen];
-#endif
+    //! Element data gathered directly into the SIMD lanes
     ScratchViews<DoubleType,TEAMHANDLETYPE,SHMEM> simdPrereqData;
     SharedMemView<DoubleType*,SHMEM> simdrhs;
     SharedMemView<DoubleType**,SHMEM> simdlhs;
@@ -84,15 +73,6 @@ struct SharedMemData_FaceElem {
      : simdFaceViews(team, nDim, nodesPerFace, faceDataNeeded),
        simdElemViews(team, nDim, nodesPerElem, elemDataNeeded)
     {
-#ifndef KOKKOS_ENABLE_CUDA
-        for(int simdIndex=0; simdIndex<simdLen; ++simdIndex) {
-          faceViews[simdIndex] = std::unique_ptr<ScratchViews<double,TEAMHANDLETYPE,SHMEM> >(new ScratchViews<double,TEAMHANDLETYPE,SHMEM>(team, nDim, nodesPerFace, faceDataNeeded));
-          elemViews[simdIndex] = std::unique_ptr<ScratchViews<double,TEAMHANDLETYPE,SHMEM> >(new ScratchViews<double,TEAMHANDLETYPE,SHMEM>(team, nDim, nodesPerElem, elemDataNeeded));
-        }
-#else
-        faceViews[0] = &simdFaceViews;
-        elemViews[0] = &simdElemViews;
-#endif
         simdrhs = get_shmem_view_1D<DoubleType,TEAMHANDLETYPE,SHMEM>(team, rhsSize);
         simdlhs = get_shmem_view_2D<DoubleType,TEAMHANDLETYPE,SHMEM>(team, rhsSize, rhsSize);
         rhs = get_shmem_view_1D<double,TEAMHANDLETYPE,SHMEM>(team, rhsSize);
@@ -111,13 +91,6 @@ struct SharedMemData_FaceElem {
     stk::mesh::NgpMesh::ConnectedNodes ngpConnectedNodes[simdLen];
     int numSimdFaces;
     int elemFaceOrdinal;
-#ifdef KOKKOS_ENABLE_CUDA
-    ScratchViews<DoubleType,TEAMHANDLETYPE,SHMEM>* faceViews[1];
-    ScratchViews<DoubleType,TEAMHANDLETYPE,SHMEM>* elemViews[1];
-#else
-    std::unique_ptr<ScratchViews<double,TEAMHANDLETYPE,SHMEM>> faceViews[simdLen];
-    std::unique_ptr<ScratchViews<double,TEAMHANDLETYPE,SHMEM>> elemViews[simdLen];
-#endif
     ScratchViews<DoubleType,TEAMHANDLETYPE,SHMEM> simdFaceViews;
     ScratchViews<DoubleType,TEAMHANDLETYPE,SHMEM> simdElemViews;
     SharedMemView<DoubleType*,SHMEM> simdrhs;
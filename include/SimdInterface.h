@@ -61,6 +61,28 @@ int get_length_of_next_simd_group(int index, int length)
   return nextLength;
 }
 
+/** Set one SIMD lane of a value
+ *
+ *  On the device DoubleType holds a single lane, so the value is assigned
+ *  directly.
+ */
+KOKKOS_INLINE_FUNCTION
+void set_simd_lane(DoubleType& data, const int simdIndex, const double value)
+{
+#ifdef KOKKOS_ENABLE_CUDA
+  data = value;
+#else
+  stk::simd::set_data(data, simdIndex, value);
+#endif
+}
+
+//! Overload for the non-SIMD views holding a single lane
+KOKKOS_INLINE_FUNCTION
+void set_simd_lane(double& data, const int /* simdIndex */, const double value)
+{
+  data = value;
+}
+
 }  // nalu
 }  // sierra
 
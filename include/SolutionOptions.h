@@ -128,6 +128,7 @@ public:
   bool meshMotion_;
   bool meshTransformation_;
   bool externalMeshDeformation_;
+  bool rigidBodyGeometryUpdate_;
   bool ncAlgGaussLabatto_;
   bool ncAlgUpwindAdvection_;
   bool ncAlgIncludePstab_;
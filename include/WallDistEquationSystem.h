@@ -14,6 +14,7 @@
 #include "EquationSystem.h"
 #include "FieldTypeDef.h"
 #include "ngp_algorithms/NodalGradAlgDriver.h"
+#include "utils/FaceDistanceBVH.h"
 
 #include <memory>
 
@@ -77,10 +78,34 @@ public:
 
   void compute_wall_distance();
 
+  /** Compute the wall distance by exact search of the wall faces
+   *
+   *  Alternative to the Poisson solve when `wall_distance_method: geometric`
+   *  is requested. Wall faces are stored in one tree per mesh motion frame;
+   *  trees for rigid frames are built once in model coordinates and queried
+   *  with points transformed into the body frame.
+   */
+  void compute_geometric_wall_distance();
+
 private:
   WallDistEquationSystem() = delete;
   WallDistEquationSystem(const WallDistEquationSystem&) = delete;
 
+  //! Wall faces that move with a single mesh motion frame
+  struct WallFaceGroup
+  {
+    FaceDistanceBVH bvh;
+
+    //! Index into the moving frames of MeshMotionAlg; -1 for stationary walls
+    int frameIdx{-1};
+
+    //! Tree is built in model coordinates and reused for all time steps
+    bool rigid{true};
+  };
+
+  void build_wall_face_groups();
+
+  void communicate_wall_distance();
 
   VectorFieldType* coordinates_{nullptr};
   ScalarFieldType* wallDistPhi_{nullptr};
@@ -91,6 +116,11 @@ private:
 
   ScalarNodalGradAlgDriver nodalGradAlgDriver_;
 
+  //! Wall parts used by the geometric wall distance computation
+  stk::mesh::PartVector wallParts_;
+
+  std::vector<WallFaceGroup> wallFaceGroups_;
+
   int pValue_{2};
 
   //! Frequency (in timesteps) at which wall distance is updated
@@ -102,6 +132,9 @@ private:
 
   //! User option to force recomputation of wall distance on restart
   bool forceInitOnRestart_{false};
+
+  //! Compute wall distance by geometric search instead of the Poisson solve
+  bool useGeometricWallDist_{false};
 };
 
 }  // nalu
@@ -12,6 +12,7 @@
 
 #include <actuator/ActuatorTypes.h>
 #include <actuator/ActuatorSearch.h>
+#include <actuator/ActuatorSpreadingCSR.h>
 #include <Enums.h>
 #include <vector>
 
@@ -45,6 +46,14 @@ struct ActuatorMeta
   int numPointsTotal_;
   std::vector<std::string> searchTargetNames_;
   stk::search::SearchMethod searchMethod_;
+  //! Reuse search results between time steps
+  bool useSearchCache_;
+  //! Relative inflation of the search radius for the cached candidates
+  double searchCacheMargin_;
+  //! Number of searches between cache statistics reports (0 disables)
+  int searchCacheReportFreq_;
+  //! Spread forces through point to node neighbor lists
+  bool useCSRSpreading_;
   ActScalarIntDv numPointsTurbine_;
 };
 
@@ -60,6 +69,10 @@ struct ActuatorBulk
 
   void stk_search_act_pnts(
     const ActuatorMeta& actMeta, stk::mesh::BulkData& stkBulk);
+  void spread_forces_csr(
+    const ActuatorMeta& actMeta,
+    stk::mesh::BulkData& stkBulk,
+    ActFixTensorDbl orientation = ActFixTensorDbl());
   void zero_source_terms(stk::mesh::BulkData& stkBulk);
   void parallel_sum_source_term(stk::mesh::BulkData& stkBulk);
   void compute_offsets(const ActuatorMeta& actMeta);
@@ -79,6 +92,8 @@ struct ActuatorBulk
   ActFixScalarBool pointIsLocal_;
   ActFixScalarInt localParallelRedundancy_;
   ActFixElemIds elemContainingPoint_;
+  ActuatorSearchCache searchCache_;
+  ActuatorSpreadingCSR spreadingCSR_;
 };
 
 } // namespace nalu
@@ -42,8 +42,21 @@ struct ActuatorMetaFAST : public ActuatorMeta
   ActFixScalarBool useUniformAziSampling_;
   ActFixScalarInt nPointsSwept_;
   ActFixScalarInt nBlades_;
+  //! Rank controlling each turbine
+  std::vector<int> turbineRanks_;
 };
 
+enum class TurbinePlacement { ROUND_ROBIN, SPREAD };
+
+/*! \brief Assign the OpenFAST turbines to ranks
+ *
+ * ROUND_ROBIN places turbine i on rank i. SPREAD distributes the turbines
+ * evenly over the full range of ranks so the controlling ranks do not pile
+ * up on the first compute nodes.
+ */
+std::vector<int> compute_turbine_ranks(
+  const int nTurbines, const int nProcs, const TurbinePlacement placement);
+
 struct ActuatorBulkFAST : public ActuatorBulk
 {
   ActuatorBulkFAST(const ActuatorMetaFAST& actMeta, double naluTimeStep);
@@ -69,6 +82,10 @@ struct ActuatorBulkFAST : public ActuatorBulk
 
   fast::OpenFAST openFast_;
   const int localTurbineId_;
+  //! Time spent advancing the local OpenFAST turbine
+  double timerFastStep_{0.0};
+  //! Time spent waiting on the ranks advancing OpenFAST
+  double timerFastWait_{0.0};
   const int tStepRatio_;
   ActDualViewHelper<ActuatorMemSpace> dvHelper_;
 };
@@ -75,7 +75,10 @@ void RunActFastComputeForce(ActuatorBulkFAST& actBulk)
   Kokkos::deep_copy(actBulk.actuatorForce_.view_host(),0.0);
   actBulk.actuatorForce_.modify_host();
   Kokkos::parallel_for("ActFastComputeForce", actBulk.local_range_policy(), ActFastComputeForce(actBulk));
+  // ranks without a turbine wait here for the OpenFAST advance to finish
+  const double startTime = NaluEnv::self().nalu_time();
   actuator_utils::reduce_view_on_host(actBulk.actuatorForce_.view_host());
+  actBulk.timerFastWait_ += NaluEnv::self().nalu_time() - startTime;
 }
 
 struct ActFastSetUpThrustCalc
@@ -17,6 +17,10 @@
 #include <stk_search/IdentProc.hpp>
 #include <stk_search/SearchMethod.hpp>
 
+#include <array>
+#include <unordered_map>
+#include <vector>
+
 // common type defs
 using theKey = stk::search::IdentProc<uint64_t, int>;
 using Point = stk::search::Point<double>;
@@ -55,6 +59,72 @@ void ExecuteFineSearch(
   ActFixScalarBool isLocalPoint,
   ActFixScalarInt localParallelRedundancy);
 
+/*! \brief Search data persisted between time steps
+ *
+ * The element boxes are built once since the search is performed in model
+ * coordinates. Candidate elements of each point are found with a sphere
+ * inflated by a margin, and are reused as long as the current search sphere
+ * is contained in the inflated sphere. Only points that escape their cached
+ * sphere are sent through the global coarse search. The element that owned
+ * each point in the previous search is tested first in the fine search.
+ */
+struct ActuatorSearchCache
+{
+  //! Invalidate all cached data, e.g. after the mesh has changed
+  void reset();
+
+  bool initialized_{false};
+
+  VecBoundElemBox elemBoxes_;
+  //! Element id to index into elemBoxes_
+  std::unordered_map<uint64_t, int> elemBoxIndex_;
+
+  //! Candidate element boxes for each point from the inflated search
+  std::vector<std::vector<int>> candidates_;
+  std::vector<std::array<double, 3>> cachedCenter_;
+  std::vector<double> cachedRadius_;
+
+  //! Element containing each point in the last fine search (0 if none)
+  std::vector<uint64_t> ownerElem_;
+
+  //! Offsets of each point into the coarse search results
+  std::vector<int> pointOffsets_;
+
+  //! Number of searches since the last report
+  int numSearches_{0};
+
+  // Search statistics (accumulated since the last report)
+  size_t numPointsQueried_{0};
+  size_t numPointsSearched_{0};
+  size_t numOwnerTests_{0};
+  size_t numOwnerHits_{0};
+};
+
+void ExecuteCachedCoarseSearch(
+  ActuatorSearchCache& cache,
+  stk::mesh::BulkData& stkBulk,
+  const std::vector<std::string>& partNameList,
+  ActFixVectorDbl points,
+  ActFixScalarDbl searchRadius,
+  const double margin,
+  ActScalarU64Dv& coarsePointIds,
+  ActScalarU64Dv& coarseElemIds,
+  stk::search::SearchMethod searchMethod);
+
+void ExecuteCachedFineSearch(
+  ActuatorSearchCache& cache,
+  stk::mesh::BulkData& stkBulk,
+  ActScalarU64Dv coarsePointIds,
+  ActScalarU64Dv coarseElemIds,
+  ActFixVectorDbl points,
+  ActFixElemIds matchElemIds,
+  ActFixVectorDbl localCoords,
+  ActFixScalarBool isLocalPoint,
+  ActFixScalarInt localParallelRedundancy);
+
+//! Print the global cache hit rates and reset the counters
+void ReportSearchCacheStatistics(ActuatorSearchCache& cache);
+
 } // namespace nalu
 } // namespace sierra
 
@@ -0,0 +1,111 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef ACTUATORSPREADINGCSR_H_
+#define ACTUATORSPREADINGCSR_H_
+
+#include <actuator/ActuatorTypes.h>
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+} // namespace mesh
+} // namespace stk
+
+namespace sierra {
+namespace nalu {
+
+/*! \brief Uniform grid hash of the locally owned nodes of the search parts
+ *
+ * Nodes are sorted by cell so the nodes of a cell are contiguous in the
+ * node arrays.
+ */
+struct ActuatorNodeHash
+{
+  void build(
+    stk::mesh::BulkData& stkBulk,
+    const std::vector<std::string>& partNameList,
+    const double cellSize);
+
+  //! Append the indices of the nodes within radius of a point
+  void nodes_in_sphere(
+    const double* center, const double radius, std::vector<int>& found) const;
+
+  double cellSize_{0.0};
+  std::vector<stk::mesh::Entity> nodes_;
+  std::vector<std::array<double, 3>> nodeCoords_;
+  //! Cell key to the [begin, end) range of its nodes
+  std::unordered_map<int64_t, std::pair<int, int>> cells_;
+};
+
+/*! \brief Gaussian force spreading through point to node neighbor lists
+ *
+ * The node hash is built once per mesh configuration. Each step the
+ * truncated kernel weights of all (node, point) pairs are stored in a
+ * compressed row structure with one row per node that receives a
+ * contribution, and the spreading is applied as a sparse matrix-vector
+ * product on device. Nodes are weighted by their full dual volume instead of
+ * the sub-control volumes of the elements found by the coarse search.
+ */
+class ActuatorSpreadingCSR
+{
+public:
+  /*! \brief Update the node hash if the mesh changed and recompute weights
+   *
+   * @param orientation Per point transformation to the blade coordinate
+   * system; an empty view selects an isotropic Gaussian
+   */
+  void compute_weights(
+    stk::mesh::BulkData& stkBulk,
+    const std::vector<std::string>& partNameList,
+    ActFixVectorDbl points,
+    ActFixVectorDbl epsilon,
+    ActFixScalarDbl searchRadius,
+    ActFixTensorDbl orientation);
+
+  /*! \brief Add the spread forces to the actuator source term on device
+   *
+   * The actuator forces must be up to date on host. The actuator source field
+   * is updated on device and synchronized back to host for the parallel sum.
+   */
+  void apply(stk::mesh::BulkData& stkBulk, ActVectorDblDv actuatorForce);
+
+  int num_rows() const { return numRows_; }
+  int num_nonzeros() const { return numNonzeros_; }
+
+private:
+  ActuatorNodeHash nodeHash_;
+  size_t meshModCount_{0};
+  bool hashIsValid_{false};
+
+  int numRows_{0};
+  int numNonzeros_{0};
+  //! Node hash index of each row
+  std::vector<int> rowNodes_;
+
+  //! Mesh index of the node of each row
+  Kokkos::DualView<stk::mesh::FastMeshIndex*, ActuatorMemSpace> rowMeshIndex_{
+    "spreadRowMeshIndex", 0};
+
+  ActScalarIntDv rowOffsets_{"spreadRowOffsets", 0};
+  ActScalarIntDv colPoints_{"spreadColPoints", 0};
+  ActScalarDblDv weights_{"spreadWeights", 0};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* ACTUATORSPREADINGCSR_H_ */
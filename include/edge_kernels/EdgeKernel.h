@@ -76,10 +76,13 @@ public:
   KOKKOS_FUNCTION
   virtual ~NGPEdgeKernel() = default;
 
+  //! Create the device copy, or update it in place if it already exists
   virtual EdgeKernel* create_on_device() final
   {
-    free_on_device();
-    deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    if (deviceCopy_ == nullptr)
+      deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    else
+      nalu_ngp::update<T>(deviceCopy_, *dynamic_cast<T*>(this));
     return deviceCopy_;
   }
 
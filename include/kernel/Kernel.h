@@ -184,10 +184,13 @@ public:
   // stored in `activeKernels_`
   KOKKOS_FUNCTION virtual ~NGPKernel() = default;
 
+  //! Create the device copy, or update it in place if it already exists
   virtual Kernel* create_on_device() final
   {
-    free_on_device();
-    deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    if (deviceCopy_ == nullptr)
+      deviceCopy_ = nalu_ngp::create<T>(*dynamic_cast<T*>(this));
+    else
+      nalu_ngp::update<T>(deviceCopy_, *dynamic_cast<T*>(this));
     return deviceCopy_;
   }
 
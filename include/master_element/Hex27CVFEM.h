@@ -231,7 +231,152 @@ protected:
     double* shape_fcn
   ) const;
 
+  // 1D quadratic Lagrange basis (nodes at -1, 0, 1) evaluated at a point set
+  template <int NumPoints>
+  struct LagrangeBasis1D
+  {
+    double val[NumPoints][nodes1D_];
+    double der[NumPoints][nodes1D_];
+  };
+
+  template <int NumPoints>
+  static void set_lagrange_basis_1d(const double* x, LagrangeBasis1D<NumPoints>& basis);
+
+  void set_tensor_product_basis();
+
+  // the 2 scs locations, the 2 x 3 Gauss points and their shifted counterparts
+  LagrangeBasis1D<nodes1D_ - 1> scsBasis_;
+  LagrangeBasis1D<numQuad_ * nodes1D_> gaussBasis_;
+  LagrangeBasis1D<numQuad_ * nodes1D_> shiftedGaussBasis_;
+
+  /** Jacobians at a tensor product of 1D point sets by sum factorization
+   *
+   *  The Hex27 shape functions are tensor products of the 1D basis, so the
+   *  nodal coordinates are contracted one direction at a time: O(p^4) work
+   *  per element from a few small 1D tables instead of O(p^6) work streaming
+   *  the dense (ip, node, dim) reference gradients. For every point f is
+   *  called with the point indices, the 1D basis values and derivatives of
+   *  the point in each direction and jac[i][j] = dx_i/dxi_j.
+   */
+  template <int NX, int NY, int NZ, typename CoordViewType, typename Functor>
+  KOKKOS_FUNCTION void tensor_product_jacobians(
+    const LagrangeBasis1D<NX>& bx,
+    const LagrangeBasis1D<NY>& by,
+    const LagrangeBasis1D<NZ>& bz,
+    const CoordViewType& coords,
+    Functor&& f) const
+  {
+    using ftype = typename CoordViewType::value_type;
+    constexpr int n1D = nodes1D_;
+
+    NALU_ALIGNED ftype xc[3][n1D][n1D][n1D];
+    for (int c = 0; c < n1D; ++c) {
+      for (int b = 0; b < n1D; ++b) {
+        for (int a = 0; a < n1D; ++a) {
+          const int n = stkNodeMap_[c][b][a];
+          for (int i = 0; i < 3; ++i) {
+            xc[i][c][b][a] = coords(n, i);
+          }
+        }
+      }
+    }
 
+    for (int pz = 0; pz < NZ; ++pz) {
+      NALU_ALIGNED ftype zv[3][n1D][n1D];
+      NALU_ALIGNED ftype zd[3][n1D][n1D];
+      for (int i = 0; i < 3; ++i) {
+        for (int b = 0; b < n1D; ++b) {
+          for (int a = 0; a < n1D; ++a) {
+            zv[i][b][a] = bz.val[pz][0] * xc[i][0][b][a];
+            zd[i][b][a] = bz.der[pz][0] * xc[i][0][b][a];
+            for (int c = 1; c < n1D; ++c) {
+              zv[i][b][a] += bz.val[pz][c] * xc[i][c][b][a];
+              zd[i][b][a] += bz.der[pz][c] * xc[i][c][b][a];
+            }
+          }
+        }
+      }
+
+      for (int py = 0; py < NY; ++py) {
+        NALU_ALIGNED ftype vv[3][n1D];
+        NALU_ALIGNED ftype dv[3][n1D];
+        NALU_ALIGNED ftype vd[3][n1D];
+        for (int i = 0; i < 3; ++i) {
+          for (int a = 0; a < n1D; ++a) {
+            vv[i][a] = by.val[py][0] * zv[i][0][a];
+            dv[i][a] = by.der[py][0] * zv[i][0][a];
+            vd[i][a] = by.val[py][0] * zd[i][0][a];
+            for (int b = 1; b < n1D; ++b) {
+              vv[i][a] += by.val[py][b] * zv[i][b][a];
+              dv[i][a] += by.der[py][b] * zv[i][b][a];
+              vd[i][a] += by.val[py][b] * zd[i][b][a];
+            }
+          }
+        }
+
+        for (int px = 0; px < NX; ++px) {
+          NALU_ALIGNED ftype jac[3][3];
+          for (int i = 0; i < 3; ++i) {
+            jac[i][0] = bx.der[px][0] * vv[i][0];
+            jac[i][1] = bx.val[px][0] * dv[i][0];
+            jac[i][2] = bx.val[px][0] * vd[i][0];
+            for (int a = 1; a < n1D; ++a) {
+              jac[i][0] += bx.der[px][a] * vv[i][a];
+              jac[i][1] += bx.val[px][a] * dv[i][a];
+              jac[i][2] += bx.val[px][a] * vd[i][a];
+            }
+          }
+          const double* val[3] = {bx.val[px], by.val[py], bz.val[pz]};
+          const double* der[3] = {bx.der[px], by.der[py], bz.der[pz]};
+          f(px, py, pz, val, der, jac);
+        }
+      }
+    }
+  }
+
+  /** Gradient operator at a point from its Jacobian and 1D basis
+   *
+   *  Same result as generic_grad_op, with the reference gradients formed
+   *  from the 1D tables; they are also written to deriv.
+   */
+  template <typename ftype, typename GradViewType>
+  KOKKOS_FUNCTION void tensor_product_grad_op(
+    const int ip,
+    const double* const val[3],
+    const double* const der[3],
+    const ftype jac[][3],
+    GradViewType& gradop,
+    GradViewType& deriv) const
+  {
+    NALU_ALIGNED ftype adjJac[3][3];
+    cofactorMatrix(adjJac, jac);
+
+    NALU_ALIGNED ftype det = ftype(0.0);
+    for (int i = 0; i < 3; ++i) det += jac[i][0] * adjJac[i][0];
+    ThrowAssertMsg(
+      stk::simd::are_any(det > tiny_positive_value()),
+      "Problem with Jacobian determinant"
+    );
+    NALU_ALIGNED const ftype inv_detj = ftype(1.0) / det;
+
+    for (int c = 0; c < nodes1D_; ++c) {
+      for (int b = 0; b < nodes1D_; ++b) {
+        const double vyvz = val[1][b] * val[2][c];
+        const double dyvz = der[1][b] * val[2][c];
+        const double vydz = val[1][b] * der[2][c];
+        for (int a = 0; a < nodes1D_; ++a) {
+          const int n = stkNodeMap_[c][b][a];
+          const double refGrad[3] = {der[0][a] * vyvz, val[0][a] * dyvz, val[0][a] * vydz};
+          for (int i = 0; i < 3; ++i) {
+            deriv(ip, n, i) = refGrad[i];
+            gradop(ip, n, i) = (adjJac[i][0] * refGrad[0]
+                              + adjJac[i][1] * refGrad[1]
+                              + adjJac[i][2] * refGrad[2]) * inv_detj;
+          }
+        }
+      }
+    }
+  }
 };
 
 // 3D Quad 27 subcontrol volume
@@ -291,6 +436,9 @@ public:
   const GradWeightType& shape_function_derivatives()
   { return referenceGradWeights_; }
 
+  const GradWeightType& shifted_shape_function_derivatives()
+  { return shiftedReferenceGradWeights_; }
+
   template <typename GradViewType, typename CoordViewType, typename OutputViewType>
   KOKKOS_FUNCTION void weighted_volumes(GradViewType referenceGradWeights, CoordViewType coords, OutputViewType volume)
   {
@@ -312,6 +460,24 @@ private:
     const double *POINTER_RESTRICT elemNodalCoords,
     const double *POINTER_RESTRICT shapeDerivs ) const;
 
+  // scv ips are ordered by sub-control volume, then tensor-product quadrature,
+  // see set_interior_info
+  template <typename CoordViewType, typename Functor>
+  KOKKOS_FUNCTION void scv_jacobians(
+    const LagrangeBasis1D<numQuad_ * nodes1D_>& gauss,
+    const CoordViewType& coords,
+    Functor&& f) const
+  {
+    constexpr int ipsPerScv = numQuad_ * numQuad_ * numQuad_;
+    tensor_product_jacobians(gauss, gauss, gauss, coords,
+      [&](int px, int py, int pz, const auto& val, const auto& der, const auto& jac) {
+        const int ip =
+          (((pz / numQuad_) * nodes1D_ + py / numQuad_) * nodes1D_ + px / numQuad_) * ipsPerScv
+          + ((pz % numQuad_) * numQuad_ + py % numQuad_) * numQuad_ + px % numQuad_;
+        f(ip, val, der, jac);
+      });
+  }
+
   InterpWeightType interpWeights_;
   GradWeightType referenceGradWeights_;
 
@@ -549,6 +715,40 @@ private:
     areav(ip, 2) = sjac[0][0] * sjac[1][1] - sjac[1][0] * sjac[0][1];
   }
 
+  // scs ips are laid out direction by direction in the U->T->S order, each
+  // direction by scs, sub-face and tensor-product quadrature, see
+  // set_interior_info
+  template <typename CoordViewType, typename Functor>
+  KOKKOS_FUNCTION void scs_jacobians(
+    const LagrangeBasis1D<numQuad_ * nodes1D_>& gauss,
+    const CoordViewType& coords,
+    Functor&& f) const
+  {
+    constexpr int ipsPerDirection = AlgTraits::numScsIp_ / AlgTraits::nDim_;
+    constexpr int ipsPerScs = ipsPerDirection / (nodes1D_ - 1);
+    constexpr int ipsPerSubFace = numQuad_ * numQuad_;
+
+    // ordinal of an ip from its scs and the Gauss points along the surface
+    auto ip_ordinal = [](int m, int p1, int p2) {
+      return m * ipsPerScs
+        + ((p2 / numQuad_) * nodes1D_ + p1 / numQuad_) * ipsPerSubFace
+        + (p2 % numQuad_) * numQuad_ + p1 % numQuad_;
+    };
+
+    tensor_product_jacobians(gauss, gauss, scsBasis_, coords,
+      [&](int px, int py, int pz, const auto& val, const auto& der, const auto& jac) {
+        f(ip_ordinal(pz, px, py), Jacobian::U_DIRECTION, val, der, jac);
+      });
+    tensor_product_jacobians(gauss, scsBasis_, gauss, coords,
+      [&](int px, int py, int pz, const auto& val, const auto& der, const auto& jac) {
+        f(ipsPerDirection + ip_ordinal(py, px, pz), Jacobian::T_DIRECTION, val, der, jac);
+      });
+    tensor_product_jacobians(scsBasis_, gauss, gauss, coords,
+      [&](int px, int py, int pz, const auto& val, const auto& der, const auto& jac) {
+        f(2 * ipsPerDirection + ip_ordinal(px, py, pz), Jacobian::S_DIRECTION, val, der, jac);
+      });
+  }
+
   InterpWeightType interpWeights_;
   GradWeightType referenceGradWeights_;
 
@@ -585,16 +785,10 @@ KOKKOS_FUNCTION void Hex27SCS::grad_op(
   ViewTypeGrad&  gradop,
   ViewTypeGrad&  deriv)
 {
-  generic_grad_op<AlgTraits>(referenceGradWeights_, coords, gradop);
-
-  // copy derivs as well.  These aren't used, but are part of the interface
-  for (int ip = 0; ip < AlgTraits::numScsIp_; ++ip) {
-    for (int n = 0; n < AlgTraits::nodesPerElement_; ++n) {
-      for (int d = 0; d < AlgTraits::nDim_; ++d) {
-        deriv(ip,n,d) = referenceGradWeights_(ip,n,d);
-      }
-    }
-  }
+  scs_jacobians(gaussBasis_, coords,
+    [&](int ip, int, const auto& val, const auto& der, const auto& jac) {
+      tensor_product_grad_op(ip, val, der, jac, gradop, deriv);
+    });
 }
 
 
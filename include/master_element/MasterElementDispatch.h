@@ -0,0 +1,116 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef MasterElementDispatch_h
+#define MasterElementDispatch_h
+
+#include "AlgTraits.h"
+#include "KokkosInterface.h"
+#include "master_element/MasterElement.h"
+#include "master_element/Hex8CVFEM.h"
+#include "master_element/Hex27CVFEM.h"
+#include "master_element/Tet4CVFEM.h"
+#include "master_element/Pyr5CVFEM.h"
+#include "master_element/Wed6CVFEM.h"
+#include "master_element/Quad42DCVFEM.h"
+#include "master_element/Quad92DCVFEM.h"
+#include "master_element/Tri32DCVFEM.h"
+
+namespace sierra {
+namespace nalu {
+
+/** Compile-time dispatch of the CVFEM master element metrics
+ *
+ *  The master elements are handed around as MasterElement pointers and every
+ *  metric evaluation goes through the vtable, which the compiler cannot see
+ *  through. When the element topology is known at compile time through
+ *  AlgTraits, the pointer is cast to the concrete master element type from
+ *  AlgTraits and the member is called with a qualified name, i.e., without
+ *  virtual dispatch. The call target is then known to the compiler, which
+ *  removes the indirect call and allows inlining where the definition of the
+ *  member is visible.
+ *
+ *  The pointers must have been obtained from
+ *  MasterElementRepo::get_surface_master_element<AlgTraits>() and
+ *  get_volume_master_element<AlgTraits>() (or the topology equivalent).
+ */
+template <typename AlgTraits>
+struct MasterElementDispatch
+{
+  using SCS = typename AlgTraits::masterElementScs_;
+  using SCV = typename AlgTraits::masterElementScv_;
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void scs_determinant(MasterElement* meSCS, Args&... args)
+  {
+    static_cast<SCS*>(meSCS)->SCS::determinant(args...);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void scs_grad_op(MasterElement* meSCS, Args&... args)
+  {
+    static_cast<SCS*>(meSCS)->SCS::grad_op(args...);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void scs_shifted_grad_op(MasterElement* meSCS, Args&... args)
+  {
+    static_cast<SCS*>(meSCS)->SCS::shifted_grad_op(args...);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void scs_gij(MasterElement* meSCS, Args&... args)
+  {
+    static_cast<SCS*>(meSCS)->SCS::gij(args...);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void scs_mij(MasterElement* meSCS, Args&... args)
+  {
+    static_cast<SCS*>(meSCS)->SCS::Mij(args...);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void scv_determinant(MasterElement* meSCV, Args&... args)
+  {
+    static_cast<SCV*>(meSCV)->SCV::determinant(args...);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void scv_grad_op(MasterElement* meSCV, Args&... args)
+  {
+    static_cast<SCV*>(meSCV)->SCV::grad_op(args...);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void scv_shifted_grad_op(MasterElement* meSCV, Args&... args)
+  {
+    static_cast<SCV*>(meSCV)->SCV::shifted_grad_op(args...);
+  }
+
+  template <typename... Args>
+  KOKKOS_FORCEINLINE_FUNCTION
+  static void scv_mij(MasterElement* meSCV, Args&... args)
+  {
+    static_cast<SCV*>(meSCV)->SCV::Mij(args...);
+  }
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
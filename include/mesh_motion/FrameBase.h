@@ -37,6 +37,33 @@ public:
   {
   }
 
+  //! Flag indicating that all motions in this frame are rigid body motions
+  bool is_rigid() const
+  {
+    for (auto& mm: meshMotionVec_)
+      if (!mm->is_rigid_body()) return false;
+
+    return true;
+  }
+
+  /** Composite transformation of a rigid frame
+   *
+   *  The transformation of a rigid frame is independent of the coordinates and
+   *  is identical for every node in the frame
+   *
+   * @return 4x4 matrix representing composite addition of motions
+   */
+  MotionBase::TransMatType rigid_transformation(const double time)
+  {
+    ThrowRequire(is_rigid());
+    return compute_transformation(time, nullptr);
+  }
+
+  const stk::mesh::PartVector& get_partvec() const
+  {
+    return partVec_;
+  }
+
 protected:
   /** Compute transformation matrix
    *
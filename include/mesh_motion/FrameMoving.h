@@ -3,6 +3,8 @@
 
 #include "FrameBase.h"
 
+#include "stk_mesh/base/NgpMesh.hpp"
+
 #include "yaml-cpp/yaml.h"
 
 #include <cassert>
@@ -27,6 +29,15 @@ public:
 
   void update_coordinates_velocity(const double time);
 
+  /** Update coordinates and mesh velocity of a rigid frame on device
+   *
+   *  The composite transformation and the affine mesh velocity are assembled
+   *  once on host and applied to all nodes in a single NGP node loop. The
+   *  fields are left modified on device.
+   */
+  void update_coordinates_velocity(
+    const stk::mesh::NgpMesh& ngpMesh, const double time);
+
   void post_compute_geometry();
 
 private:
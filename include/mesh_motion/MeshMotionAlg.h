@@ -23,6 +23,20 @@ public:
 
   void post_compute_geometry();
 
+  const std::vector<std::shared_ptr<FrameMoving>>& get_moving_frames() const
+  {
+    return movingFrameVec_;
+  }
+
+  //! Flag indicating that all moving frames only contain rigid body motions
+  bool is_rigid() const
+  {
+    for (const auto& frame: movingFrameVec_)
+      if (!frame->is_rigid()) return false;
+
+    return true;
+  }
+
   bool onlyInitialDisplacement_ = true;
 
 private:
@@ -35,7 +49,7 @@ private:
 
   void compute_set_centroid();
 
-  const stk::mesh::BulkData& bulk_;
+  stk::mesh::BulkData& bulk_;
 
   /** Moving frame vector
    *
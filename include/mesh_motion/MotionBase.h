@@ -72,6 +72,16 @@ public:
     return transMat_;
   }
 
+  /** Flag indicating that the motion is a rigid body motion
+   *
+   *  Rigid body motions preserve distances and angles, and the transformation
+   *  matrix does not depend on the coordinates of the point being moved
+   */
+  virtual bool is_rigid_body() const
+  {
+    return false;
+  }
+
   void set_computed_centroid( std::vector<double>& centroid )
   {
     std::copy_n(centroid.begin(), threeDVecSize, origin_.begin());
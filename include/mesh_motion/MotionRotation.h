@@ -31,6 +31,11 @@ public:
     const double* mxyz,
     const double* cxyz );
 
+  virtual bool is_rigid_body() const
+  {
+    return true;
+  }
+
 private:
   MotionRotation() = delete;
   MotionRotation(const MotionRotation&) = delete;
@@ -12,13 +12,34 @@
 #define GEOMETRYALGDRIVER_H
 
 #include "ngp_algorithms/NgpAlgDriver.h"
+#include "mesh_motion/MotionBase.h"
 #include "FieldTypeDef.h"
+#include "KokkosInterface.h"
+
+#include <vector>
 
 namespace sierra {
 namespace nalu {
 
 class Realm;
 
+/** Reference copy of a geometry field for the rigid body geometry update
+ *
+ *  Holds the field values of the last full geometry computation on device so
+ *  that the rotated field is always obtained from the reference values.
+ */
+struct RigidGeometryRef
+{
+  //! Index into values by entity local offset (-1 if the entity is not cached)
+  Kokkos::View<int*, MemSpace> index;
+
+  //! Number of field components of each cached entity
+  Kokkos::View<int*, MemSpace> numComp;
+
+  //! Reference field values of the cached entities
+  Kokkos::View<double**, MemSpace> values;
+};
+
 /** Compute geometry fields
  *
  *  This class coordinates the computation of the following fields:
@@ -37,6 +58,12 @@ class Realm;
  *  See GeometryInteriorAlg and GeometryBoundaryAlg for more details of the
  *  exact computations.
  *
+ *  When all moving frames undergo rigid body motion and the user requests
+ *  `rigid_body_geometry_update`, volumes are left untouched after the first
+ *  computation. The area vectors of that computation are kept as a reference
+ *  and rotated with the frame rotation relative to the reference orientation
+ *  instead of being recomputed by the master elements.
+ *
  *  \sa GeometryInteriorAlg, GeometryBoundaryAlg
  */
 class GeometryAlgDriver : public NgpAlgDriver
@@ -52,9 +79,15 @@ public:
   //! Synchronize fields after algorithms have done their work
   virtual void post_work() override;
 
+  //! Execute geometry algorithms, skipping cached wall function geometry
+  virtual void execute() override;
+
   /** Register wall function geometry calculation algorithm
    *
-   *  Need a specialization here to track whether the user has requested wall functions
+   *  Need a specialization here to track whether the user has requested wall
+   *  functions. The wall function algorithms are stored separately so that
+   *  their results can be reused when the mesh only undergoes rigid body
+   *  motion (see wallFuncGeomCached_).
    */
   template<template <typename> class FaceElemAlg, class... Args>
   void register_wall_func_algorithm(
@@ -64,14 +97,75 @@ public:
     const std::string& algSuffix,
     Args&&... args)
   {
-    register_face_elem_algorithm<FaceElemAlg>(
-      algType, part, elemTopo, algSuffix, std::forward<Args>(args)...);
+    const auto topo = part->topology();
+    const std::string entityName = "face_" + topo.name() + "_" + elemTopo.name();
+
+    const std::string algName =
+      unique_name(algType, entityName, algSuffix);
+
+    const auto it = wallFuncAlgMap_.find(algName);
+    if (it == wallFuncAlgMap_.end()) {
+      wallFuncAlgMap_[algName].reset(
+        nalu_ngp::create_face_elem_algorithm<Algorithm, FaceElemAlg>(
+          topo, elemTopo, realm_, part, std::forward<Args>(args)...));
+      NaluEnv::self().naluOutputP0()
+        << "Created algorithm = " << algName << std::endl;
+    } else {
+      it->second->partVec_.push_back(part);
+    }
     hasWallFunc_ = true;
   }
 
 private:
+  //! Run all geometry algorithms
+  void compute_geometry();
+
+  //! Check whether the cached geometry can be updated by rotation
+  bool use_rigid_geometry_update();
+
+  //! Rotate the reference area vectors to the current frame orientations
+  void rotate_rigid_geometry();
+
+  //! Store the current area vectors and frame transformations as reference
+  void cache_rigid_geometry();
+
+  //! Compare rotated area vectors against a full recomputation
+  void check_rigid_geometry();
+
+  //! Wall function geometry algorithms
+  std::map<std::string, std::unique_ptr<Algorithm>> wallFuncAlgMap_;
+
   //! Flag to track whether wall functions are active
   bool hasWallFunc_{false};
+
+  /** Flag indicating that the wall function geometry is up to date
+   *
+   *  Wall normal distance and wall area are invariant under rigid body
+   *  motion, so they are only recomputed when the mesh deforms, a mesh
+   *  motion frame contains non-rigid motions, or the mesh is modified.
+   */
+  bool wallFuncGeomCached_{false};
+
+  //! Mesh modification count of the cached wall function geometry
+  size_t wallFuncGeomModCount_{0};
+
+  //! Wall function geometry is recomputed during the current execute() call
+  bool computeWallFunc_{false};
+
+  //! Frame transformations of the reference geometry
+  std::vector<MotionBase::TransMatType> rigidFrameTrans_;
+
+  //! Reference edge area vectors
+  RigidGeometryRef edgeAreaRef_;
+
+  //! Reference exposed area vectors
+  RigidGeometryRef exposedAreaRef_;
+
+  //! Flag indicating that the reference geometry is available
+  bool rigidGeomCached_{false};
+
+  //! Mesh modification count of the cached geometry
+  size_t rigidGeomModCount_{0};
 };
 
 }  // nalu
@@ -0,0 +1,54 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef METRICCACHEELEMALG_H
+#define METRICCACHEELEMALG_H
+
+#include "Algorithm.h"
+#include "ElemDataRequests.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+namespace sierra {
+namespace nalu {
+
+class Realm;
+class MasterElementMetricCache;
+
+/** Evaluate the master element metrics stored in the metric cache
+ *
+ *  \sa MasterElementMetricCache
+ */
+template <typename AlgTraits>
+class MetricCacheElemAlg : public Algorithm
+{
+public:
+  MetricCacheElemAlg(
+    Realm&,
+    stk::mesh::Part*,
+    const MasterElementMetricCache&);
+
+  virtual ~MetricCacheElemAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  const MasterElementMetricCache& cache_;
+
+  ElemDataRequests dataNeeded_;
+
+  MasterElement* meSCV_{nullptr};
+  MasterElement* meSCS_{nullptr};
+};
+
+}  // nalu
+}  // sierra
+
+
+#endif /* METRICCACHEELEMALG_H */
@@ -0,0 +1,68 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NODALGRADNONCONFORMALALG_H
+#define NODALGRADNONCONFORMALALG_H
+
+#include "Algorithm.h"
+#include "FieldTypeDef.h"
+
+#include "stk_mesh/base/Types.hpp"
+
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** DG nodal gradient contribution of the non-conformal interfaces
+ *
+ *  Device version of AssembleNodalGradNonConformalAlgorithm and
+ *  AssembleNodalGradUNonConformalAlgorithm. The interface value at each
+ *  Gauss point is the average of the current and opposing face values and is
+ *  assembled to the nearest node using the flattened DgInfo data held by the
+ *  NonConformalManager.
+ */
+template <typename PhiType, typename GradPhiType>
+class NodalGradNonConformalAlg : public Algorithm
+{
+  static_assert(
+    ((std::is_same<PhiType, ScalarFieldType>::value &&
+      std::is_same<GradPhiType, VectorFieldType>::value) ||
+     (std::is_same<PhiType, VectorFieldType>::value &&
+      std::is_same<GradPhiType, GenericFieldType>::value)),
+    "Improper field types passed to nodal gradient calculator");
+
+public:
+  NodalGradNonConformalAlg(
+    Realm&, stk::mesh::Part*, PhiType* phi, GradPhiType* gradPhi);
+
+  virtual ~NodalGradNonConformalAlg() = default;
+
+  virtual void execute() override;
+
+private:
+  unsigned phi_{stk::mesh::InvalidOrdinal};
+  unsigned gradPhi_{stk::mesh::InvalidOrdinal};
+  unsigned dualNodalVol_{stk::mesh::InvalidOrdinal};
+  unsigned exposedAreaVec_{stk::mesh::InvalidOrdinal};
+
+  //! Fields required on the opposing faces ghosted to this rank
+  std::vector<const stk::mesh::FieldBase*> ghostFieldVec_;
+};
+
+using ScalarNodalGradNonConformalAlg =
+  NodalGradNonConformalAlg<ScalarFieldType, VectorFieldType>;
+
+using VectorNodalGradNonConformalAlg =
+  NodalGradNonConformalAlg<VectorFieldType, GenericFieldType>;
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* NODALGRADNONCONFORMALALG_H */
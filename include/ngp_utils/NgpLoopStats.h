@@ -0,0 +1,87 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NGPLOOPSTATS_H
+#define NGPLOOPSTATS_H
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace sierra {
+namespace nalu {
+namespace nalu_ngp {
+
+/** Scratch memory and throughput statistics of the NGP mesh loops
+ *
+ *  The statistics are only collected when Nalu-Wind is configured with
+ *  `ENABLE_NGP_LOOP_STATS`, see NgpLoopTimer in NgpLoopUtils.h. The loops are
+ *  aggregated by algorithm name over all calls and reported at the end of the
+ *  simulation.
+ */
+class NgpLoopStats
+{
+public:
+  struct LoopInfo
+  {
+    //! Number of times the loop was executed
+    size_t numCalls{0};
+    //! Largest scratch size requested per team
+    size_t bytesPerTeam{0};
+    //! Largest scratch size requested per thread
+    size_t bytesPerThread{0};
+    //! Total number of buckets over all calls
+    size_t numBuckets{0};
+    //! Total number of SIMD groups over all calls (0 for non-SIMD loops)
+    size_t numSimdGroups{0};
+    //! Total number of entities over all calls
+    size_t numEntities{0};
+    //! Total time spent in the loop (seconds)
+    double time{0.0};
+  };
+
+  static NgpLoopStats& self();
+
+  //! True if the code was configured to collect loop statistics
+  static constexpr bool enabled()
+  {
+#ifdef NALU_NGP_LOOP_STATS
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  //! Add the statistics of one execution of a loop
+  void record(
+    const std::string& algName,
+    const size_t bytesPerTeam,
+    const size_t bytesPerThread,
+    const size_t numBuckets,
+    const size_t numSimdGroups,
+    const size_t numEntities,
+    const double time);
+
+  /** Print the statistics aggregated over all MPI ranks
+   *
+   *  Must be called on all ranks. Does nothing unless enabled.
+   */
+  void report() const;
+
+private:
+  NgpLoopStats() = default;
+
+  std::map<std::string, LoopInfo> loops_;
+};
+
+}  // nalu_ngp
+}  // nalu
+}  // sierra
+
+#endif /* NGPLOOPSTATS_H */
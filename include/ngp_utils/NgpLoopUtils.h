@@ -11,15 +11,18 @@
 #ifndef NGPLOOPUTILS_H
 #define NGPLOOPUTILS_H
 
+#include <string>
 #include <type_traits>
 
 #include "ngp_utils/NgpTypes.h"
 #include "ngp_utils/NgpScratchData.h"
 #include "ngp_utils/NgpMEUtils.h"
+#include "ngp_utils/NgpLoopStats.h"
 #include "CopyAndInterleave.h"
 #include "ElemDataRequests.h"
 #include "ElemDataRequestsGPU.h"
 #include "ScratchViews.h"
+#include "master_element/MasterElementDispatch.h"
 
 #include "stk_mesh/base/Selector.hpp"
 #include "stk_mesh/base/Ngp.hpp"
@@ -67,13 +70,8 @@ ngp_calc_thread_shmem_size(
     dataReq.get_total_num_fields(),
     count_needed_field_views(dataReq.get_host_fields()));
 
-#ifndef KOKKOS_ENABLE_CUDA
-  // On host account for extra data to store the SIMD and non-SIMD versions of
-  // the ScratchViews
-  return (preReqSize + mdvSize) * 2 * simdLen;
-#else
-  return (preReqSize + mdvSize);
-#endif
+  // The element data is gathered directly into the SIMD ScratchViews
+  return (preReqSize + mdvSize) * simdLen;
 }
 
 /** Estimate the bytes required per thread for face/element ScratchViews
@@ -98,6 +96,101 @@ inline int ngp_calc_thread_shmem_size(
   return (faceMemSize + elemMemSize);
 }
 
+/** Count the entities and SIMD groups in the buckets of a loop
+ *
+ *  @param mesh A STK NGP mesh instance
+ *  @param rank Rank of the buckets
+ *  @param buckets Bucket IDs of the loop
+ *  @param numEntities Number of entities in the buckets
+ *  @param numSimdGroups Number of SIMD groups, bucket by bucket
+ */
+template <typename Mesh, typename BucketIds>
+void ngp_loop_entity_counts(
+  const Mesh& mesh,
+  const stk::topology::rank_t rank,
+  const BucketIds& buckets,
+  size_t& numEntities,
+  size_t& numSimdGroups)
+{
+  Kokkos::parallel_reduce(
+    "ngp_loop_entity_counts", buckets.size(),
+    KOKKOS_LAMBDA(const int ib, size_t& nEntities) {
+      nEntities += mesh.get_bucket(rank, buckets.device_get(ib)).size();
+    }, numEntities);
+  Kokkos::parallel_reduce(
+    "ngp_loop_simd_group_counts", buckets.size(),
+    KOKKOS_LAMBDA(const int ib, size_t& nGroups) {
+      nGroups += get_num_simd_groups(
+        mesh.get_bucket(rank, buckets.device_get(ib)).size());
+    }, numSimdGroups);
+}
+
+/** Record the scratch sizes, entity counts and time of an NGP loop
+ *
+ *  The timer covers the lifetime of the object, i.e., it is created just
+ *  before the parallel loop and goes out of scope after it. Does nothing
+ *  unless the code was configured with `ENABLE_NGP_LOOP_STATS`; when enabled
+ *  the device is fenced before and after the loop so that the recorded time
+ *  is the time of the loop. Statistics are reported by NgpLoopStats::report.
+ */
+class NgpLoopTimer
+{
+public:
+  /**
+   *  @param algName Name under which the loop is reported
+   *  @param mesh A STK NGP mesh instance
+   *  @param rank Rank of the buckets
+   *  @param buckets Bucket IDs of the loop
+   *  @param bytesPerTeam Scratch bytes requested per team
+   *  @param bytesPerThread Scratch bytes requested per thread
+   *  @param isSimd True if the loop processes SIMD groups of entities
+   */
+  template <typename Mesh, typename BucketIds>
+  NgpLoopTimer(
+    const std::string& algName,
+    const Mesh& mesh,
+    const stk::topology::rank_t rank,
+    const BucketIds& buckets,
+    const size_t bytesPerTeam,
+    const size_t bytesPerThread,
+    const bool isSimd)
+  {
+    if (!NgpLoopStats::enabled()) return;
+
+    algName_ = algName;
+    bytesPerTeam_ = bytesPerTeam;
+    bytesPerThread_ = bytesPerThread;
+    numBuckets_ = buckets.size();
+    ngp_loop_entity_counts(mesh, rank, buckets, numEntities_, numSimdGroups_);
+    if (!isSimd) numSimdGroups_ = 0;
+
+    Kokkos::fence();
+    timer_.reset();
+  }
+
+  ~NgpLoopTimer()
+  {
+    if (!NgpLoopStats::enabled()) return;
+
+    Kokkos::fence();
+    NgpLoopStats::self().record(
+      algName_, bytesPerTeam_, bytesPerThread_, numBuckets_, numSimdGroups_,
+      numEntities_, timer_.seconds());
+  }
+
+  NgpLoopTimer(const NgpLoopTimer&) = delete;
+  NgpLoopTimer& operator=(const NgpLoopTimer&) = delete;
+
+private:
+  Kokkos::Timer timer_;
+  std::string algName_;
+  size_t bytesPerTeam_{0};
+  size_t bytesPerThread_{0};
+  size_t numBuckets_{0};
+  size_t numSimdGroups_{0};
+  size_t numEntities_{0};
+};
+
 } // impl
 
 /** Execute the given functor for all entities in a Kokkos parallel loop
@@ -127,6 +220,7 @@ void run_entity_algorithm(
 
   const auto& buckets = mesh.get_bucket_ids(rank, sel);
   auto team_exec = TeamPolicy(buckets.size(), Kokkos::AUTO);
+  impl::NgpLoopTimer loopTimer(algName, mesh, rank, buckets, 0, 0, false);
 
   Kokkos::parallel_for(
     algName, team_exec,
@@ -174,6 +268,7 @@ void run_entity_par_reduce(
 
   const auto& buckets = mesh.get_bucket_ids(rank, sel);
   auto team_exec = TeamPolicy(buckets.size(), Kokkos::AUTO);
+  impl::NgpLoopTimer loopTimer(algName, mesh, rank, buckets, 0, 0, false);
 
   Kokkos::parallel_reduce(
     algName, team_exec,
@@ -216,6 +311,7 @@ void run_entity_par_reduce(
 
   const auto& buckets = mesh.get_bucket_ids(rank, sel);
   auto team_exec = TeamPolicy(buckets.size(), Kokkos::AUTO);
+  impl::NgpLoopTimer loopTimer(algName, mesh, rank, buckets, 0, 0, false);
 
   Kokkos::parallel_reduce(
     algName, team_exec,
@@ -320,8 +416,12 @@ inline void run_elem_algorithm(
  *  @param dataReqs Instance contaning element data to be added to ScratchViews
  *  @param sel STK mesh selector to choose buckets for looping
  *  @param algorithm The functor to be executed on each element
+ *
+ *  When the element topology is known at compile time, AlgTraits selects the
+ *  static dispatch of the master element metrics, see MasterElementDispatch.
  */
 template<
+  typename AlgTraits = void,
   typename Mesh,
   typename FieldManager,
   typename DataReqType,
@@ -358,6 +458,8 @@ void run_elem_algorithm(
   const auto& buckets = ngpMesh.get_bucket_ids(rank, sel);
   auto team_exec = impl::ngp_mesh_team_policy<TeamPolicy>(
     buckets.size(), bytes_per_team, bytes_per_thread);
+  impl::NgpLoopTimer loopTimer(
+    algName, ngpMesh, rank, buckets, bytes_per_team, bytes_per_thread, true);
 
   Kokkos::parallel_for(
     algName, team_exec, KOKKOS_LAMBDA(const TeamHandleType& team) {
@@ -383,14 +485,11 @@ void run_elem_algorithm(
             EntityInfo<Mesh>{meshIdx, elem, ngpMesh.get_nodes(meshIdx)};
 
           fill_pre_req_data(dataReqNGP, ngpMesh, rank, elem,
-                            *elemData.scrView[is]);
+                            elemData.simdScrView, is);
         }
+        clear_unused_simd_lanes(elemData.simdScrView, nSimdElems);
 
-#ifndef KOKKOS_ENABLE_CUDA
-        copy_and_interleave(elemData.scrView, nSimdElems, elemData.simdScrView);
-#endif
-
-        fill_master_element_views(dataReqNGP, elemData.simdScrView);
+        fill_master_element_views<AlgTraits>(dataReqNGP, elemData.simdScrView);
         algorithm(elemData);
       });
   });
@@ -414,6 +513,7 @@ void run_elem_algorithm(
  *  @param reduceVal A Kokkos reducer type
  */
 template<
+  typename AlgTraits = void,
   typename Mesh,
   typename FieldManager,
   typename DataReqType,
@@ -453,6 +553,8 @@ void run_elem_par_reduce(
   const auto& buckets = ngpMesh.get_bucket_ids(rank, sel);
   auto team_exec = impl::ngp_mesh_team_policy<TeamPolicy>(
     buckets.size(), bytes_per_team, bytes_per_thread);
+  impl::NgpLoopTimer loopTimer(
+    algName, ngpMesh, rank, buckets, bytes_per_team, bytes_per_thread, true);
 
   Kokkos::parallel_reduce(
     algName, team_exec,
@@ -480,14 +582,11 @@ void run_elem_par_reduce(
               EntityInfo<Mesh>{meshIdx, elem, ngpMesh.get_nodes(meshIdx)};
 
             fill_pre_req_data(dataReqNGP, ngpMesh, rank, elem,
-                              *elemData.scrView[is]);
+                              elemData.simdScrView, is);
           }
+          clear_unused_simd_lanes(elemData.simdScrView, nSimdElems);
 
-#ifndef KOKKOS_ENABLE_CUDA
-          copy_and_interleave(elemData.scrView, nSimdElems, elemData.simdScrView);
-#endif
-
-          fill_master_element_views(dataReqNGP, elemData.simdScrView);
+          fill_master_element_views<AlgTraits>(dataReqNGP, elemData.simdScrView);
           algorithm(elemData, threadVal);
         }, ReducerType(bktVal));
 
@@ -540,6 +639,9 @@ void run_face_elem_algorithm(
   const auto& buckets = ngpMesh.get_bucket_ids(sideRank, sel);
   auto team_exec = impl::ngp_mesh_team_policy<TeamPolicy>(
     buckets.size(), bytes_per_team, bytes_per_thread);
+  impl::NgpLoopTimer loopTimer(
+    algName, ngpMesh, sideRank, buckets, bytes_per_team, bytes_per_thread,
+    true);
 
   Kokkos::parallel_for(
     algName, team_exec, KOKKOS_LAMBDA(const TeamHandleType& team) {
@@ -589,10 +691,10 @@ void run_face_elem_algorithm(
 
               fill_pre_req_data(
                 faceDataNGP, ngpMesh, sideRank, face,
-                *faceElemData.scrFaceView[simdFaceIdx]);
+                faceElemData.simdFaceView, simdFaceIdx);
               fill_pre_req_data(
                 elemDataNGP, ngpMesh, elemRank, elem,
-                *faceElemData.scrElemView[simdFaceIdx]);
+                faceElemData.simdElemView, simdFaceIdx);
 
               elemFaceOrd = faceOrd;
               ++simdFaceIdx;
@@ -601,14 +703,10 @@ void run_face_elem_algorithm(
             faceElemData.numSimdElems = simdFaceIdx;
             nFacesProcessed += simdFaceIdx;
 
-#ifndef KOKKOS_ENABLE_CUDA
-            copy_and_interleave(
-              faceElemData.scrFaceView, faceElemData.numSimdElems,
-              faceElemData.simdFaceView);
-            copy_and_interleave(
-              faceElemData.scrElemView, faceElemData.numSimdElems,
-              faceElemData.simdElemView);
-#endif
+            clear_unused_simd_lanes(
+              faceElemData.simdFaceView, faceElemData.numSimdElems);
+            clear_unused_simd_lanes(
+              faceElemData.simdElemView, faceElemData.numSimdElems);
             fill_master_element_views(
               faceDataNGP, faceElemData.simdFaceView, elemFaceOrd);
             fill_master_element_views(
@@ -664,6 +762,9 @@ void run_face_elem_par_reduce(
   const auto& buckets = ngpMesh.get_bucket_ids(sideRank, sel);
   auto team_exec = impl::ngp_mesh_team_policy<TeamPolicy>(
     buckets.size(), bytes_per_team, bytes_per_thread);
+  impl::NgpLoopTimer loopTimer(
+    algName, ngpMesh, sideRank, buckets, bytes_per_team, bytes_per_thread,
+    true);
 
   Kokkos::parallel_reduce(
     algName, team_exec,
@@ -715,10 +816,10 @@ void run_face_elem_par_reduce(
 
               fill_pre_req_data(
                 faceDataNGP, ngpMesh, sideRank, face,
-                *faceElemData.scrFaceView[simdFaceIdx]);
+                faceElemData.simdFaceView, simdFaceIdx);
               fill_pre_req_data(
                 elemDataNGP, ngpMesh, elemRank, elem,
-                *faceElemData.scrElemView[simdFaceIdx]);
+                faceElemData.simdElemView, simdFaceIdx);
 
               elemFaceOrd = faceOrd;
               ++simdFaceIdx;
@@ -727,14 +828,10 @@ void run_face_elem_par_reduce(
             faceElemData.numSimdElems = simdFaceIdx;
             nFacesProcessed += simdFaceIdx;
 
-#ifndef KOKKOS_ENABLE_CUDA
-            copy_and_interleave(
-              faceElemData.scrFaceView, faceElemData.numSimdElems,
-              faceElemData.simdFaceView);
-            copy_and_interleave(
-              faceElemData.scrElemView, faceElemData.numSimdElems,
-              faceElemData.simdElemView);
-#endif
+            clear_unused_simd_lanes(
+              faceElemData.simdFaceView, faceElemData.numSimdElems);
+            clear_unused_simd_lanes(
+              faceElemData.simdElemView, faceElemData.numSimdElems);
             fill_master_element_views(
               faceDataNGP, faceElemData.simdFaceView, elemFaceOrd);
             fill_master_element_views(
@@ -758,6 +855,7 @@ template<
   typename DataReqType,
   typename AlgFunctor>
 void run_face_elem_algorithm_nosimd(
+  const std::string& algName,
   const MeshInfo<Mesh, FieldManager>& meshInfo,
   const DataReqType& faceDataReqs,
   const DataReqType& elemDataReqs,
@@ -791,8 +889,12 @@ void run_face_elem_algorithm_nosimd(
   const auto& buckets = ngpMesh.get_bucket_ids(sideRank, sel);
   auto team_exec = impl::ngp_mesh_team_policy<TeamPolicy>(
     buckets.size(), bytes_per_team, bytes_per_thread);
+  impl::NgpLoopTimer loopTimer(
+    algName, ngpMesh, sideRank, buckets, bytes_per_team, bytes_per_thread,
+    false);
 
-  Kokkos::parallel_for(team_exec, KOKKOS_LAMBDA(const TeamHandleType& team) {
+  Kokkos::parallel_for(
+    algName, team_exec, KOKKOS_LAMBDA(const TeamHandleType& team) {
       auto bktId = buckets.device_get(team.league_rank());
       auto& bkt = ngpMesh.get_bucket(sideRank, bktId);
 
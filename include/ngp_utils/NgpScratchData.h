@@ -47,16 +47,6 @@ struct ElemSimdData
     const ElemDataRequestsGPU& dataReq)
     : simdScrView(team, ndim, nodesPerElem, dataReq)
   {
-#ifdef KOKKOS_ENABLE_CUDA
-    scrView[0] = &simdScrView;
-#else
-    for (int si=0; si < simdLen; ++si) {
-      scrView[si].reset(
-        new ScratchViews<double, TeamHandleType, ShmemType>(
-          team, ndim, nodesPerElem, dataReq));
-    }
-#endif
-
     simdScrView.fill_static_meviews(dataReq);
   }
 
@@ -66,18 +56,12 @@ struct ElemSimdData
   const EntityInfoType* info() const
   { return elemInfo; }
 
-  //! Gathered element data (always in SIMD datatype)
-  ScratchViews<DoubleType, TeamHandleType, ShmemType> simdScrView;
-
-  /** Non-SIMD gathered element data
+  /** Gathered element data (always in SIMD datatype)
    *
-   *  When executing on GPUs we dont
+   *  The element data is gathered directly into the SIMD lanes, there is no
+   *  intermediate non-SIMD copy.
    */
-#ifdef KOKKOS_ENABLE_CUDA
-  ScratchViews<DoubleType, TeamHandleType, ShmemType>* scrView[1];
-#else
-  std::unique_ptr<ScratchViews<double, TeamHandleType, ShmemType>> scrView[simdLen];
-#endif
+  ScratchViews<DoubleType, TeamHandleType, ShmemType> simdScrView;
 
   //! Element connectivity info for each element within the SIMD group
   EntityInfoType elemInfo[simdLen];
@@ -105,20 +89,6 @@ struct FaceElemSimdData
     : simdFaceView(team, ndim, nodesPerFace, faceDataReqs),
       simdElemView(team, ndim, nodesPerElem, elemDataReqs)
   {
-#ifdef KOKKOS_ENABLE_CUDA
-    scrFaceView[0] = &simdFaceView;
-    scrElemView[0] = &simdElemView;
-#else
-    for (int si=0; si < simdLen; ++si) {
-      scrFaceView[si].reset(
-        new ScratchViews<double, TeamHandleType, ShmemType>(
-          team, ndim, nodesPerFace, faceDataReqs));
-      scrElemView[si].reset(
-        new ScratchViews<double, TeamHandleType, ShmemType>(
-          team, ndim, nodesPerElem, elemDataReqs));
-    }
-#endif
-
     simdFaceView.fill_static_meviews(faceDataReqs);
     simdElemView.fill_static_meviews(elemDataReqs);
   }
@@ -132,18 +102,6 @@ struct FaceElemSimdData
   ScratchViews<DoubleType, TeamHandleType, ShmemType> simdFaceView;
   ScratchViews<DoubleType, TeamHandleType, ShmemType> simdElemView;
 
-  /** Non-SIMD gathered element data
-   *
-   *  When executing on GPUs we dont
-   */
-#ifdef KOKKOS_ENABLE_CUDA
-  ScratchViews<DoubleType, TeamHandleType, ShmemType>* scrFaceView[1];
-  ScratchViews<DoubleType, TeamHandleType, ShmemType>* scrElemView[1];
-#else
-  std::unique_ptr<ScratchViews<double, TeamHandleType, ShmemType>> scrFaceView[simdLen];
-  std::unique_ptr<ScratchViews<double, TeamHandleType, ShmemType>> scrElemView[simdLen];
-#endif
-
   EntityInfoType faceInfo[simdLen];
 
   int faceOrd;
@@ -0,0 +1,169 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef NODEKERNELPACK_H
+#define NODEKERNELPACK_H
+
+#include "node_kernels/NodeKernel.h"
+
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** A statically composed set of node kernels
+ *
+ *  AssembleNGPNodeSolverAlgorithm holds its node kernels as NodeKernel
+ *  pointers and calls them through the vtable in a loop for every node. When
+ *  the registered kernels are exactly `Kernels...` (same types, in any
+ *  order), the node loop can instead call the kernels one after the other
+ *  with qualified names, i.e., without virtual dispatch and with the kernel
+ *  sequence known to the compiler.
+ *
+ *  The kernels are called in the order of the pack. They only accumulate
+ *  into the LHS/RHS, so the result is the same as for the runtime path up to
+ *  the order of the floating point sums; it is identical when the kernels
+ *  were registered in pack order.
+ */
+template <typename... Kernels>
+struct NodeKernelPack
+{
+  static constexpr int numKernels = sizeof...(Kernels);
+
+  /** Match the registered kernels against the pack, in any order
+   *
+   *  On success, the index of the registered kernel of every pack entry is
+   *  stored for execute.
+   */
+  bool match(const std::vector<std::unique_ptr<NodeKernel>>& kernels)
+  {
+    if (static_cast<int>(kernels.size()) != numKernels) return false;
+
+    const std::type_info* types[] = {&typeid(Kernels)...};
+    std::vector<bool> used(numKernels, false);
+    for (int j = 0; j < numKernels; ++j) {
+      slots_[j] = -1;
+      for (int i = 0; i < numKernels; ++i) {
+        if (!used[i] && (typeid(*kernels[i]) == *types[j])) {
+          used[i] = true;
+          slots_[j] = i;
+          break;
+        }
+      }
+      if (slots_[j] < 0) return false;
+    }
+    return true;
+  }
+
+  /** Execute all kernels of the pack for one node
+   *
+   *  @param ngpKernels Device instances of the kernels in registration order
+   */
+  template <typename KernelView>
+  KOKKOS_FORCEINLINE_FUNCTION
+  void execute(
+    const KernelView& ngpKernels,
+    NodeKernelTraits::LhsType& lhs,
+    NodeKernelTraits::RhsType& rhs,
+    const stk::mesh::FastMeshIndex& node) const
+  {
+    execute_impl<0, Kernels...>(ngpKernels, lhs, rhs, node);
+  }
+
+private:
+  template <int I, typename KernelView>
+  KOKKOS_FORCEINLINE_FUNCTION
+  void execute_impl(
+    const KernelView&,
+    NodeKernelTraits::LhsType&,
+    NodeKernelTraits::RhsType&,
+    const stk::mesh::FastMeshIndex&) const
+  {}
+
+  template <int I, typename Kernel, typename... Rest, typename KernelView>
+  KOKKOS_FORCEINLINE_FUNCTION
+  void execute_impl(
+    const KernelView& ngpKernels,
+    NodeKernelTraits::LhsType& lhs,
+    NodeKernelTraits::RhsType& rhs,
+    const stk::mesh::FastMeshIndex& node) const
+  {
+    NodeKernel* kernel = ngpKernels(slots_[I]);
+    static_cast<Kernel*>(kernel)->Kernel::execute(lhs, rhs, node);
+    execute_impl<I + 1, Rest...>(ngpKernels, lhs, rhs, node);
+  }
+
+  //! Index of the registered kernel of every pack entry
+  Kokkos::Array<int, numKernels> slots_;
+};
+
+/** Runtime-configured sequence of node kernels
+ *
+ *  Fallback for kernel combinations without a NodeKernelPack, the kernels are
+ *  executed through the vtable in registration order.
+ */
+struct DynamicNodeKernelPack
+{
+  bool match(const std::vector<std::unique_ptr<NodeKernel>>&)
+  { return true; }
+
+  template <typename KernelView>
+  KOKKOS_FORCEINLINE_FUNCTION
+  void execute(
+    const KernelView& ngpKernels,
+    NodeKernelTraits::LhsType& lhs,
+    NodeKernelTraits::RhsType& rhs,
+    const stk::mesh::FastMeshIndex& node) const
+  {
+    const size_t numKernels = ngpKernels.extent(0);
+    for (size_t i=0; i < numKernels; ++i) {
+      NodeKernel* kernel = ngpKernels(i);
+      kernel->execute(lhs, rhs, node);
+    }
+  }
+};
+
+/** Select the first pack of `Packs...` matching the registered kernels
+ *
+ *  Calls `func(pack)` with the matched pack and returns true, or returns
+ *  false if none of the packs match.
+ */
+template <typename... Packs>
+struct NodeKernelPackDispatch;
+
+template <>
+struct NodeKernelPackDispatch<>
+{
+  template <typename Function>
+  static bool apply(const std::vector<std::unique_ptr<NodeKernel>>&, Function&)
+  { return false; }
+};
+
+template <typename Pack, typename... Rest>
+struct NodeKernelPackDispatch<Pack, Rest...>
+{
+  template <typename Function>
+  static bool apply(
+    const std::vector<std::unique_ptr<NodeKernel>>& kernels, Function& func)
+  {
+    Pack pack;
+    if (pack.match(kernels)) {
+      func(pack);
+      return true;
+    }
+    return NodeKernelPackDispatch<Rest...>::apply(kernels, func);
+  }
+};
+
+}  // nalu
+}  // sierra
+
+#endif /* NODEKERNELPACK_H */
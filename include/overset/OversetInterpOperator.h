@@ -0,0 +1,150 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef OVERSETINTERPOPERATOR_H
+#define OVERSETINTERPOPERATOR_H
+
+#include "KokkosInterface.h"
+#include "overset/OversetFieldData.h"
+
+#include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Types.hpp>
+
+#include <functional>
+#include <vector>
+
+#include <mpi.h>
+
+namespace stk {
+namespace mesh {
+class BulkData;
+}
+}
+
+namespace sierra {
+namespace nalu {
+
+/** Cached overset fringe interpolation operator
+ *
+ *  Each row of the operator interpolates the solution at a receptor node from
+ *  the nodes of its donor element. Rows live on the MPI rank that owns the
+ *  donor element and are grouped by the rank of the receptor node. Applying
+ *  the operator evaluates all rows for all fields in one device kernel per
+ *  field, exchanges the interpolated values for all fields in a single
+ *  message per neighbor rank, and scatters them into the receptor nodes.
+ *
+ *  Receptor nodes are identified by an opaque (tag, index) pair that is
+ *  resolved to an STK node on the receptor rank when the operator is
+ *  finalized.
+ */
+class OversetInterpOperator
+{
+public:
+  using ReceptorResolver =
+    std::function<stk::mesh::Entity(const int tag, const int index)>;
+
+  /** Collective call; duplicates the communicator of the mesh so that the
+   *  value exchange cannot match messages posted by other code
+   */
+  OversetInterpOperator(stk::mesh::BulkData& bulk);
+
+  ~OversetInterpOperator();
+
+  OversetInterpOperator(const OversetInterpOperator&) = delete;
+  OversetInterpOperator& operator=(const OversetInterpOperator&) = delete;
+
+  //! Remove all rows before a new connectivity update
+  void clear();
+
+  /** Add the interpolation row of a receptor node
+   *
+   *  @param recvProc MPI rank of the receptor node
+   *  @param recvTag Tag identifying the receptor node on recvProc
+   *  @param recvIndex Index identifying the receptor node on recvProc
+   *  @param nodes Donor element nodes
+   *  @param weights Interpolation weights of the donor element nodes
+   *  @param numNodes Number of donor element nodes
+   */
+  void add_row(
+    const int recvProc,
+    const int recvTag,
+    const int recvIndex,
+    const stk::mesh::Entity* nodes,
+    const double* weights,
+    const int numNodes);
+
+  /** Build the device data structures and the communication pattern
+   *
+   *  Collective call; must be invoked after all rows have been added.
+   */
+  void finalize(const ReceptorResolver& resolver);
+
+  //! Interpolate all fields to the receptor nodes
+  void apply(const std::vector<OversetFieldData>& fields);
+
+  //! Number of rows evaluated on this rank
+  size_t num_rows() const { return rowProcs_.size(); }
+
+private:
+  using IndexView = Kokkos::View<int*, MemSpace>;
+  using WeightView = Kokkos::View<double*, MemSpace>;
+  using MeshIndexView = Kokkos::View<stk::mesh::FastMeshIndex*, MemSpace>;
+  using ValueView = Kokkos::View<double*, MemSpace>;
+
+  //! Recompute the device mesh indices if the mesh was modified
+  void update_mesh_indices();
+
+  //! Grow the exchange buffers to hold nComp values per row
+  void reserve_values(const int nComp);
+
+  stk::mesh::BulkData& bulk_;
+
+  //! Private communicator for the value exchange
+  MPI_Comm comm_;
+
+  //! Receptor rank of each row (host)
+  std::vector<int> rowProcs_;
+  //! Receptor (tag, index) pair of each row (host)
+  std::vector<int> rowKeys_;
+  //! CSR row offsets, donor nodes and weights (host); rows are sorted by
+  //! receptor rank in finalize
+  std::vector<int> rowOffsets_{0};
+  std::vector<stk::mesh::Entity> colNodes_;
+  std::vector<double> colWeights_;
+
+  //! Receptor nodes in the order their values arrive
+  std::vector<stk::mesh::Entity> recvNodes_;
+
+  //! Neighbor ranks and [begin, end) row ranges for the exchange
+  std::vector<int> sendProcs_;
+  std::vector<int> sendOffsets_;
+  std::vector<int> recvProcs_;
+  std::vector<int> recvOffsets_;
+
+  IndexView d_rowOffsets_;
+  WeightView d_weights_;
+  MeshIndexView d_cols_;
+  MeshIndexView d_recvNodes_;
+
+  //! Exchange buffers storing the nComp values of a row contiguously; they
+  //! are only grown, apply uses the leading (rows x nComp) part
+  ValueView d_sendVals_;
+  ValueView d_recvVals_;
+  ValueView::HostMirror h_sendVals_;
+  ValueView::HostMirror h_recvVals_;
+
+  //! Mesh modification count used to build the device mesh indices
+  size_t meshModCount_{0};
+  bool meshIndicesValid_{false};
+};
+
+} // namespace nalu
+} // namespace sierra
+
+#endif /* OVERSETINTERPOPERATOR_H */
@@ -107,6 +107,13 @@ public:
   //! Timer for overset connectivity
   double timerConnectivity_{0.0};
 
+  //! Portion of the connectivity time spent copying mesh data to and from
+  //! the connectivity library
+  double timerConnectivityCopy_{0.0};
+
+  //! Portion of the connectivity time spent in the donor search
+  double timerConnectivitySearch_{0.0};
+
   //! Timer for overset field interpolations
   double timerFieldUpdate_{0.0};
 
@@ -9,6 +9,7 @@
 
 #include "overset/TiogaOptions.h"
 #include "overset/OversetFieldData.h"
+#include "overset/OversetInterpOperator.h"
 #include "yaml-cpp/yaml.h"
 
 #include <vector>
@@ -80,6 +81,20 @@ public:
    */
   void update_element_volumes();
 
+  /** Set the motion of this mesh block
+   *
+   *  With persistent registration, the coordinates are only refreshed for
+   *  moving blocks and the node/cell resolutions for deforming blocks.
+   *
+   *  @param isMoving Flag indicating that the coordinates of the block change
+   *  @param isRigid Flag indicating that the block moves as a rigid body
+   */
+  void set_motion(const bool isMoving, const bool isRigid)
+  {
+    isMoving_ = isMoving;
+    isRigid_ = isRigid;
+  }
+
   /** Register this block with TIOGA
    *
    *  Wrapper method to handle mesh block registration using TIOGA API. In
@@ -108,8 +123,13 @@ public:
    *
    *  @param tg Reference to TIOGA API object (provided by TiogaSTKIface).
    *  @param egvec List of {donorElement, receptorMPIRank} pairs to be populated
+   *  @param interpOp If not null, the donor weights are added as rows of the
+   *  interpolation operator
    */
-  void get_donor_info(TIOGA::tioga&, stk::mesh::EntityProcVec&);
+  void get_donor_info(
+    TIOGA::tioga&,
+    stk::mesh::EntityProcVec&,
+    sierra::nalu::OversetInterpOperator* interpOp = nullptr);
 
   void register_solution(
     TIOGA::tioga&,
@@ -137,6 +157,12 @@ public:
   inline const std::vector<int>& iblank_cell() const
   { return iblank_cell_; }
 
+  //! Unique body tag of this block in TIOGA
+  int mesh_tag() const { return meshtag_; }
+
+  //! Mesh parts comprising this block
+  const stk::mesh::PartVector& mesh_parts() const { return blkParts_; }
+
   //! Return the block name for this mesh
   const std::string& block_name() const { return block_name_; }
 
@@ -173,6 +199,13 @@ private:
    */
   void process_elements();
 
+  //! Flag indicating that the registered volumes are still valid
+  bool volumes_current() const
+  {
+    return tiogaOpts_.persistent_registration() && volumesCurrent_ &&
+           (!isMoving_ || isRigid_);
+  }
+
   /** Reset iblank data with moving mesh applications
    *
    */
@@ -308,6 +341,18 @@ private:
   //! Flag to check if we are are already initialized
   bool is_init_ { true };
 
+  //! Flag indicating that the block coordinates change with time
+  bool isMoving_{true};
+
+  //! Flag indicating that the block moves as a rigid body
+  bool isRigid_{false};
+
+  //! Flag indicating xyz_ holds the coordinates of a static block
+  bool coordsCurrent_{false};
+
+  //! Flag indicating node_res_ and cell_res_ hold the current volumes
+  bool volumesCurrent_{false};
+
 };
 
 } // namespace tioga
@@ -47,6 +47,16 @@ public:
 
   bool reduce_fringes() const { return reduceFringes_; }
 
+  bool batched_interpolation() const { return batchedInterpolation_; }
+
+  bool persistent_registration() const { return persistentRegistration_; }
+
+  bool incremental_ghosting() const { return incrementalGhosting_; }
+
+  int ghosting_halo_layers() const { return ghostingHaloLayers_; }
+
+  int ghosting_retain_steps() const { return ghostingRetainSteps_; }
+
 private:
   //! Symmetry plane direction [1 = x; 2 = y; 3 = z]; default = 3
   int symmetryDir_{3};
@@ -74,6 +84,38 @@ private:
   //! Option to let TIOGA attempt to reduce fringes.
   bool reduceFringes_{false};
 
+  /** Perform overset field updates with a cached interpolation operator
+   *
+   *  The donor weights returned by TIOGA are stored once per connectivity
+   *  update and all fields are interpolated and exchanged together instead
+   *  of going through TIOGA data updates.
+   */
+  bool batchedInterpolation_{false};
+
+  /** Keep the TIOGA mesh block arrays between connectivity updates
+   *
+   *  Coordinates are only copied for blocks that move, and node and cell
+   *  resolutions only for blocks that deform. Static blocks register the
+   *  arrays populated during the first connectivity update.
+   */
+  bool persistentRegistration_{false};
+
+  /** Only update the overset ghosting with the change in donor candidates
+   *
+   *  Donor candidates are the donor elements from TIOGA padded with layers of
+   *  node neighbors so that the donors after a small mesh motion are already
+   *  ghosted. Ghosted elements are retained for a number of connectivity
+   *  updates after they were last a candidate so that elements moving in and
+   *  out of the donor set do not trigger mesh modifications.
+   */
+  bool incrementalGhosting_{false};
+
+  //! Layers of neighbor elements added around donors in incremental mode
+  int ghostingHaloLayers_{1};
+
+  //! Connectivity updates an unused ghost is kept in incremental mode
+  int ghostingRetainSteps_{10};
+
   //! Indicates whether the user has set the number of mandatory fringe points
   //! in the input file.
   bool hasNumFringe_{false};
@@ -10,10 +10,12 @@
 
 #include "overset/TiogaOptions.h"
 #include "overset/OversetFieldData.h"
+#include "overset/OversetInterpOperator.h"
 
 #include <vector>
 #include <memory>
 #include <array>
+#include <map>
 
 namespace YAML {
 class Node;
@@ -94,10 +96,27 @@ private:
    */
   void load(const YAML::Node&);
 
+  /** Determine which mesh blocks move and whether the motion is rigid
+   *
+   *  Used with persistent registration to skip refreshing the TIOGA arrays
+   *  that do not change between connectivity updates.
+   */
+  void set_block_motion();
+
   /** Ghost donor elements to receptor MPI ranks
    */
   void update_ghosting();
 
+  /** Pad the donor elements to be ghosted and retain recent ghosts
+   *
+   *  Used with incremental ghosting. Pads the donor elements with layers of
+   *  locally owned neighbor elements and keeps the existing ghosts that were
+   *  candidates within the retention window, so that only the change in the
+   *  candidate set modifies the mesh. The donors are not extrapolated with
+   *  the mesh motion.
+   */
+  void pad_donor_candidates();
+
   /** Reset all connectivity data structures when recomputing connectivity
    */
   void reset_data_structures();
@@ -133,6 +152,9 @@ private:
 
   TiogaOptions tiogaOpts_;
 
+  //! Cached fringe interpolation operator (batched interpolation)
+  sierra::nalu::OversetInterpOperator interpOp_;
+
   //! List of TIOGA data structures for each mesh block participating in overset
   //! connectivity
   std::vector<std::unique_ptr<TiogaBlock>> blocks_;
@@ -144,6 +166,13 @@ private:
   //! MPI ranks
   stk::mesh::EntityProcVec elemsToGhost_;
 
+  //! Last connectivity update at which a {donor element ID, receptor rank}
+  //! pair was a donor candidate (incremental ghosting)
+  std::map<std::pair<stk::mesh::EntityId, int>, int> ghostLastUsed_;
+
+  //! Number of ghosting updates performed
+  int ghostingStep_{0};
+
   //! List of receptor nodes that are shared entities across MPI ranks. This
   //! information is used to synchronize the field vs. fringe point status for
   //! these shared nodes across processor boundaries.
@@ -46,11 +46,25 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& /* fields */) const
+  {
+    return true;
+  }
+
   double compute_h_rt(
       const double &T,
       const double *pt_poly);
   
   std::vector<double> refMassFraction_;
+  PropertyCoeffView refMassFractionDevice_;
   
 };
 
@@ -71,6 +85,20 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& fields) const
+  {
+    fields.push_back(massFraction_);
+    return true;
+  }
+
   double compute_h_rt(
       const double &T,
       const double *pt_poly);
@@ -94,6 +122,19 @@ public:
     double *indVarList,
     stk::mesh::Entity node);
 
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& /* fields */) const
+  {
+    return true;
+  }
+
   double specificHeat_;
   double referenceTemperature_;
 
@@ -115,12 +156,28 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& fields) const
+  {
+    fields.push_back(massFraction_);
+    return true;
+  }
+
   // field definition and extraction
   const double referenceTemperature_;
   const size_t cpVecSize_;
   GenericFieldType *massFraction_;
   std::vector<double> cpVec_;
   std::vector<double> hfVec_;
+  PropertyCoeffView cpVecDevice_;
+  PropertyCoeffView hfVecDevice_;
 };
 
 
@@ -14,6 +14,8 @@
 
 #include <Algorithm.h>
 
+#include <memory>
+
 namespace stk {
 namespace mesh {
 class FieldBase;
@@ -26,6 +28,7 @@ namespace nalu{
 
 class Realm;
 class PropertyEvaluator;
+class PropertyChangeTracker;
 
 class GenericPropAlgorithm : public Algorithm
 {
@@ -37,13 +40,15 @@ public:
     stk::mesh::FieldBase * prop,
     PropertyEvaluator *propEvaluator);
 
-  virtual ~GenericPropAlgorithm() {}
+  virtual ~GenericPropAlgorithm();
 
   virtual void execute();
 
   stk::mesh::FieldBase *prop_;
   PropertyEvaluator *propEvaluator_;
-  
+
+  // buckets to re-evaluate for lazy property evaluation
+  std::unique_ptr<PropertyChangeTracker> changeTracker_;
 };
 
 } // namespace nalu
@@ -41,6 +41,19 @@ public:
   double execute(
     double *indVarList,
     stk::mesh::Entity node);
+
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& /* fields */) const
+  {
+    return true;
+  }
   
   const double pRef_;
   const double R_;
@@ -62,6 +75,20 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& fields) const
+  {
+    fields.push_back(massFraction_);
+    return true;
+  }
   
   double compute_mw(
       const double *yk);
@@ -76,6 +103,7 @@ public:
   // reference mw vector; size and declaration
   size_t mwVecSize_;
   std::vector<double> mwVec_;
+  PropertyCoeffView mwVecDevice_;
   
 };
 
@@ -93,6 +121,20 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& fields) const
+  {
+    fields.push_back(pressure_);
+    return true;
+  }
+
   // reference quantities
   const double R_;
 
@@ -119,6 +161,20 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& fields) const
+  {
+    fields.push_back(massFraction_);
+    return true;
+  }
   
   double compute_mw(
       const double *yk);
@@ -134,6 +190,7 @@ public:
   // reference mw vector; size and declaration
   size_t mwVecSize_;
   std::vector<double> mwVec_;
+  PropertyCoeffView mwVecDevice_;
   
 };
 
@@ -53,6 +53,12 @@ public:
   std::vector<std::vector<double> > lowPolynomialCoeffs_;
   std::vector<std::vector<double> > highPolynomialCoeffs_;
 
+  // device copies; polynomial coeffs are stored with a stride per species
+  size_t polyStride_;
+  PropertyCoeffView mwDevice_;
+  PropertyCoeffView lowPolynomialCoeffsDevice_;
+  PropertyCoeffView highPolynomialCoeffsDevice_;
+
 };
 
 } // namespace nalu
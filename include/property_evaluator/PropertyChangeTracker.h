@@ -0,0 +1,92 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PropertyChangeTracker_h
+#define PropertyChangeTracker_h
+
+#include <property_evaluator/PropertyEvaluator.h>
+#include <KokkosInterface.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace stk {
+namespace mesh {
+class FieldBase;
+class Selector;
+}
+}
+
+namespace sierra{
+namespace nalu{
+
+class Realm;
+
+/** Tracks the change of the inputs of a nodal property between evaluations
+ *
+ *  Used for the lazy property evaluation (`lazy_evaluation_tolerance` in the
+ *  material_properties section). The tracker keeps a copy of the input
+ *  fields of every node bucket as of the last evaluation of that bucket.
+ *  Before an evaluation, the maximum change of the inputs within each bucket
+ *  is computed, measured relative to max(|value|, 1). Buckets whose inputs
+ *  changed by less than the tolerance are skipped; the others are evaluated
+ *  and their copy of the inputs is updated.
+ *
+ *  All buckets are evaluated after a mesh modification and at the first
+ *  evaluation of a time step, since the states of the property field are
+ *  rotated at the beginning of a time step.
+ */
+class PropertyChangeTracker
+{
+public:
+  PropertyChangeTracker(
+    Realm& realm,
+    const double tolerance,
+    const std::vector<stk::mesh::FieldBase*>& fields);
+
+  //! Flag the buckets of the selector whose property must be re-evaluated
+  const PropertyBucketMask& stale_buckets(const stk::mesh::Selector& sel);
+
+  //! True if the (host) bucket was flagged by the last call to stale_buckets
+  bool is_stale(const unsigned bucketId) const
+  { return hostMask_(bucketId) != 0; }
+
+private:
+  void allocate(const stk::mesh::Selector& sel);
+
+  Realm& realm_;
+
+  const double tolerance_;
+
+  std::vector<stk::mesh::FieldBase*> fields_;
+
+  //! Offset of the (bucket, field) inputs in the snapshot array
+  Kokkos::View<int64_t**, Kokkos::LayoutRight, MemSpace> offsets_;
+
+  //! Number of components of the (bucket, field) inputs
+  Kokkos::View<int**, Kokkos::LayoutRight, MemSpace> numComps_;
+
+  //! Inputs at the last evaluation of every bucket
+  Kokkos::View<double*, MemSpace> snapshot_;
+
+  //! Maximum relative change of the inputs per bucket
+  Kokkos::View<double*, MemSpace> bucketChange_;
+
+  PropertyBucketMask mask_;
+  PropertyBucketMask::HostMirror hostMask_;
+
+  size_t meshModCount_{0};
+  int timeStepCount_{-1};
+  bool allocated_{false};
+};
+
+} // namespace nalu
+} // namespace Sierra
+
+#endif
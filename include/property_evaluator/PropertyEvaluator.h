@@ -12,13 +12,29 @@
 #ifndef PropertyEvaluator_h
 #define PropertyEvaluator_h
 
+#include <KokkosInterface.h>
+
 #include <stk_mesh/base/Entity.hpp>
+#include <stk_mesh/base/Ngp.hpp>
 
 #include <vector>
 
+namespace stk {
+namespace mesh {
+class FieldBase;
+class Selector;
+}
+}
+
 namespace sierra{
 namespace nalu{
 
+//! Device copy of the (species) coefficients of a property evaluator
+using PropertyCoeffView = Kokkos::View<double*, MemSpace>;
+
+//! Node buckets to evaluate, indexed by bucket id; empty for all buckets
+using PropertyBucketMask = Kokkos::View<int*, MemSpace>;
+
 class PropertyEvaluator
 {
 public:
@@ -29,7 +45,36 @@ public:
   virtual double execute(
     double *indVarList,
     stk::mesh::Entity node = stk::mesh::Entity()) = 0;
-  
+
+  /** Evaluate the property at all selected nodes on device
+   *
+   *  indVar is the independent variable field (typically temperature), or
+   *  nullptr for evaluators without one. Only the buckets flagged in
+   *  bucketMask are evaluated. Returns false if the evaluator has no device
+   *  implementation; the caller then loops over the nodes on host and calls
+   *  execute().
+   */
+  virtual bool execute_ngp(
+    const stk::mesh::NgpMesh& /* ngpMesh */,
+    const stk::mesh::Selector& /* sel */,
+    stk::mesh::FieldBase& /* prop */,
+    stk::mesh::FieldBase* /* indVar */,
+    const PropertyBucketMask& /* bucketMask */)
+  {
+    return false;
+  }
+
+  /** Nodal fields, besides the independent variable, the property depends on
+   *
+   *  Returns false if the dependencies are not known, which disables the
+   *  lazy property evaluation for this evaluator.
+   */
+  virtual bool input_fields(
+    std::vector<stk::mesh::FieldBase*>& /* fields */) const
+  {
+    return false;
+  }
+
 };
 
 } // namespace nalu
@@ -0,0 +1,106 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+#ifndef PropertyEvaluatorNgp_h
+#define PropertyEvaluatorNgp_h
+
+#include "KokkosInterface.h"
+#include "property_evaluator/PropertyEvaluator.h"
+#include "ngp_utils/NgpLoopUtils.h"
+
+#include "stk_mesh/base/FieldBase.hpp"
+#include "stk_mesh/base/GetNgpField.hpp"
+#include "stk_mesh/base/Ngp.hpp"
+#include "stk_mesh/base/Selector.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+using PropertyMeshIndex =
+  nalu_ngp::NGPMeshTraits<stk::mesh::NgpMesh>::MeshIndex;
+
+//! Copy host coefficients to a device view
+inline PropertyCoeffView
+create_property_coeffs(
+  const std::string& name, const std::vector<double>& values)
+{
+  PropertyCoeffView coeffs(name, values.size());
+  auto hostCoeffs = Kokkos::create_mirror_view(coeffs);
+  for (size_t i = 0; i < values.size(); ++i)
+    hostCoeffs(i) = values[i];
+  Kokkos::deep_copy(coeffs, hostCoeffs);
+  return coeffs;
+}
+
+/** Copy per-species polynomial coefficients to a device view
+ *
+ *  The coefficients are flattened species by species with a stride of
+ *  `stride` values. Species with fewer coefficients are padded with zeros.
+ */
+inline PropertyCoeffView
+create_property_coeffs(
+  const std::string& name,
+  const std::vector<std::vector<double>>& values,
+  const size_t stride)
+{
+  std::vector<double> flat(values.size() * stride, 0.0);
+  for (size_t k = 0; k < values.size(); ++k)
+    for (size_t j = 0; j < std::min(stride, values[k].size()); ++j)
+      flat[k * stride + j] = values[k][j];
+  return create_property_coeffs(name, flat);
+}
+
+/** Evaluate a nodal property on device
+ *
+ *  Executes `propFunc(T, meshIdx)` for every node in the selector and stores
+ *  the result in the (scalar) property field. Nodes in buckets that are not
+ *  flagged in a (non-empty) bucket mask keep their value. `T` is the value of the
+ *  independent variable field at the node; if no independent variable is
+ *  provided the value passed is meaningless and must not be used by the
+ *  functor. Additional nodal fields are captured by the functor itself.
+ *
+ *  The functor is inlined into the node loop, i.e., the property evaluator
+ *  is dispatched once per call and not once per node.
+ */
+template <typename PropFunctor>
+void run_property_evaluator(
+  const std::string& algName,
+  const stk::mesh::NgpMesh& ngpMesh,
+  const stk::mesh::Selector& sel,
+  stk::mesh::FieldBase& prop,
+  stk::mesh::FieldBase* indVar,
+  const PropertyBucketMask& bucketMask,
+  const PropFunctor propFunc)
+{
+  const bool allBuckets = (bucketMask.extent(0) == 0);
+
+  auto& ngpIndVar =
+    stk::mesh::get_updated_ngp_field<double>((indVar != nullptr) ? *indVar : prop);
+  ngpIndVar.sync_to_device();
+  auto& ngpProp = stk::mesh::get_updated_ngp_field<double>(prop);
+  ngpProp.sync_to_device();
+
+  nalu_ngp::run_entity_algorithm(
+    algName, ngpMesh, stk::topology::NODE_RANK, sel,
+    KOKKOS_LAMBDA(const PropertyMeshIndex& mi) {
+      if (!allBuckets && (bucketMask(mi.bucket->bucket_id()) == 0))
+        return;
+      ngpProp.get(mi, 0) = propFunc(ngpIndVar.get(mi, 0), mi);
+    });
+  ngpProp.modify_on_device();
+}
+
+} // namespace nalu
+} // namespace sierra
+
+#endif
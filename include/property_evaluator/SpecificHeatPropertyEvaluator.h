@@ -45,12 +45,26 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& /* fields */) const
+  {
+    return true;
+  }
   
   double compute_cp_r(
       const double &T,
       const double *pt_poly);
 
   std::vector<double> refMassFraction_;
+  PropertyCoeffView refMassFractionDevice_;
 
 };
 
@@ -71,6 +85,20 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& fields) const
+  {
+    fields.push_back(massFraction_);
+    return true;
+  }
+
   double compute_cp_r(
       const double &T,
       const double *pt_poly);
@@ -94,10 +122,25 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& fields) const
+  {
+    fields.push_back(massFraction_);
+    return true;
+  }
+
   // field definition and extraction
   const size_t cpVecSize_;
   GenericFieldType *massFraction_;
   std::vector<double> cpVec_;
+  PropertyCoeffView cpVecDevice_;
 };
 
 } // namespace nalu
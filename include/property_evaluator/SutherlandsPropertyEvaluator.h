@@ -43,6 +43,19 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& /* fields */) const
+  {
+    return true;
+  }
   
   double compute_viscosity(
       const double &T,
@@ -51,6 +64,10 @@ public:
   std::vector<double> refMassFraction_;
   std::vector<std::vector<double> > polynomialCoeffs_;
 
+  // device copies
+  PropertyCoeffView refMassFractionDevice_;
+  PropertyCoeffView polynomialCoeffsDevice_;
+
 };
 
 class SutherlandsYkPropertyEvaluator : public PropertyEvaluator
@@ -67,6 +84,20 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  virtual bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& fields) const
+  {
+    fields.push_back(massFraction_);
+    return true;
+  }
+
   virtual double compute_viscosity(
       const double &T,
       const double *pt_poly);
@@ -77,6 +108,7 @@ public:
   
   // polynomial coeffs
   std::vector<std::vector<double> > polynomialCoeffs_;
+  PropertyCoeffView polynomialCoeffsDevice_;
   
 };
 
@@ -95,6 +127,13 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
   const double tRef_;
 };
 
@@ -15,6 +15,7 @@
 #include <Algorithm.h>
 
 // standard c++
+#include <memory>
 #include <string>
 
 namespace stk {
@@ -29,6 +30,7 @@ namespace nalu{
 
 class Realm;
 class PropertyEvaluator;
+class PropertyChangeTracker;
 
 class TemperaturePropAlgorithm : public Algorithm
 {
@@ -41,14 +43,16 @@ public:
     PropertyEvaluator *propEvaluator,
     std::string tempName = "temperature");
 
-  virtual ~TemperaturePropAlgorithm() {}
+  virtual ~TemperaturePropAlgorithm();
 
   virtual void execute();
 
   stk::mesh::FieldBase *prop_;
   PropertyEvaluator *propEvaluator_;
   stk::mesh::FieldBase *temperature_;
-  
+
+  // buckets to re-evaluate for lazy property evaluation
+  std::unique_ptr<PropertyChangeTracker> changeTracker_;
 };
 
 } // namespace nalu
@@ -40,6 +40,19 @@ public:
       double *indVarList,
       stk::mesh::Entity node);
 
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& /* fields */) const
+  {
+    return true;
+  }
+
   // reference quantities
   const double aw_;
   const double bw_;
@@ -57,6 +70,19 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& /* fields */) const
+  {
+    return true;
+  }
   
   // reference quantities
   const double aw_;
@@ -76,6 +102,19 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& /* fields */) const
+  {
+    return true;
+  }
   
   // reference quantities
   const double aw_;
@@ -97,6 +136,19 @@ public:
     double *indVarList,
     stk::mesh::Entity node);
 
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& /* fields */) const
+  {
+    return true;
+  }
+
   double compute_h(
     const double T);
 
@@ -121,6 +173,19 @@ public:
   double execute(
       double *indVarList,
       stk::mesh::Entity node);
+
+  bool execute_ngp(
+      const stk::mesh::NgpMesh& ngpMesh,
+      const stk::mesh::Selector& sel,
+      stk::mesh::FieldBase& prop,
+      stk::mesh::FieldBase* indVar,
+      const PropertyBucketMask& bucketMask);
+
+  bool input_fields(
+      std::vector<stk::mesh::FieldBase*>& /* fields */) const
+  {
+    return true;
+  }
   
   // reference quantities
   const double aw_;
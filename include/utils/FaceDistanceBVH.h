@@ -0,0 +1,105 @@
+// Copyright 2017 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS), National Renewable Energy Laboratory, University of Texas Austin,
+// Northwest Research Associates. Under the terms of Contract DE-NA0003525
+// with NTESS, the U.S. Government retains certain rights in this software.
+//
+// This software is released under the BSD 3-clause license. See LICENSE file
+// for more details.
+//
+
+
+#ifndef FACEDISTANCEBVH_H
+#define FACEDISTANCEBVH_H
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace sierra {
+namespace nalu {
+
+/** Bounding volume hierarchy for exact point-to-surface distance queries
+ *
+ *  Stores a surface as a collection of triangles (3-D) or line segments (2-D)
+ *  in a binary tree of axis-aligned bounding boxes. Quadrilateral faces are
+ *  split into two triangles by the caller. The tree is built once and can be
+ *  queried any number of times; for surfaces undergoing rigid body motion the
+ *  caller transforms the query points into the frame the tree was built in
+ *  instead of rebuilding it.
+ */
+class FaceDistanceBVH
+{
+public:
+  using Point = std::array<double, 3>;
+
+  FaceDistanceBVH() = default;
+  ~FaceDistanceBVH() = default;
+
+  //! Remove all primitives and the tree
+  void clear();
+
+  //! Add a triangle; coordinates are 3-D
+  void add_triangle(const double* a, const double* b, const double* c);
+
+  //! Add a line segment; coordinates are 3-D (z = 0 for 2-D meshes)
+  void add_segment(const double* a, const double* b);
+
+  //! Build the tree after all primitives have been added
+  void build();
+
+  /** Minimum distance from a point to the surface
+   *
+   *  @param[in] x       Query point (3-D)
+   *  @param[in] maxDist Upper bound on the distance of interest, used to prune
+   *                     the search; returned as is if no primitive is closer
+   */
+  double min_distance(
+    const double* x,
+    const double maxDist = std::numeric_limits<double>::max()) const;
+
+  size_t num_primitives() const { return numVerts_.size(); }
+
+  bool is_built() const { return isBuilt_; }
+
+private:
+  struct Node
+  {
+    Point bmin;
+    Point bmax;
+    //! First primitive (leaf) or index of the left child (interior)
+    int first;
+    //! Number of primitives (leaf) or negated index of the right child
+    int count;
+  };
+
+  int build_recursive(int begin, int end);
+
+  double primitive_distance_sq(const int prim, const double* x) const;
+
+  static double box_distance_sq(const Node&, const double* x);
+
+  //! Maximum number of primitives stored in a leaf
+  static constexpr int leafSize_{4};
+
+  //! Vertex coordinates, three vertices per primitive
+  std::vector<Point> verts_;
+
+  //! Number of vertices of each primitive (2 or 3)
+  std::vector<int> numVerts_;
+
+  //! Primitive ordering after the tree build
+  std::vector<int> primIds_;
+
+  //! Primitive centroids used to partition the tree
+  std::vector<Point> centroids_;
+
+  std::vector<Node> nodes_;
+
+  bool isBuilt_{false};
+};
+
+}  // nalu
+}  // sierra
+
+#endif /* FACEDISTANCEBVH_H */
@@ -52,6 +52,27 @@ void compute_precise_ghosting_lists(
   stk::mesh::EntityProcVec& curSendGhosts,
   std::vector<stk::mesh::EntityKey>& recvGhostsToRemove);
 
+/** Pad the elements to be ghosted with layers of node neighbor elements
+ *
+ *  Each layer adds the locally owned elements sharing a node with the
+ *  elements of the previous layer, ghosted to the same rank. The result is
+ *  sorted and unique.
+ */
+void add_node_neighbor_layers(
+  const stk::mesh::BulkData& bulk,
+  stk::mesh::EntityProcVec& elemsToGhost,
+  const int numLayers);
+
+/** Check whether two selectors share entities of a given rank on any rank
+ *
+ *  Must be called on all MPI ranks.
+ */
+bool selectors_intersect(
+  const stk::mesh::BulkData& bulk,
+  const stk::mesh::EntityRank rank,
+  const stk::mesh::Selector& sel1,
+  const stk::mesh::Selector& sel2);
+
 /** Return a field ordinal given the name of the field
  */
 inline
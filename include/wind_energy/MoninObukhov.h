@@ -64,6 +64,133 @@ T psih_unstable(const T& zeta, const T gamma = 16.0)
   return (stk::math::log(0.5 * (1.0 + phih)));
 }
 
+/** Momentum stability function without branching on the stability regime
+ *
+ *  Both the stable and unstable forms are evaluated with zeta clipped to the
+ *  range where each is valid, and the result is selected based on the sign of
+ *  the surface heat flux. Suitable for SIMD types where lanes may be in
+ *  different regimes.
+ */
+template<typename T>
+KOKKOS_FORCEINLINE_FUNCTION
+T psim(const T& zeta, const T& Tflux, const T& beta, const T& gamma)
+{
+  const T zetaStable = stk::math::max(zeta, T(0.0));
+  const T zetaUnstable = stk::math::min(zeta, T(0.0));
+  return stk::math::if_then_else(
+    (Tflux > 0.0), psim_unstable(zetaUnstable, gamma),
+    psim_stable(zetaStable, beta));
+}
+
+/** Friction velocity from Monin-Obukhov similarity theory
+ *
+ *  Solves \f$u_\tau = \kappa u_h / (\ln(z_h/z_0) - \psi_m(z_h/L))\f$ with a
+ *  secant iteration. All lanes perform a fixed number of iterations, lanes
+ *  that have converged are frozen, and neutral or zero-velocity lanes are
+ *  selected at the end, so the same code path vectorizes over a batch of
+ *  faces when `T` is a SIMD type.
+ *
+ *  @param uh    Tangential velocity at the first grid point
+ *  @param zh    Height of the first grid point
+ *  @param term1 \f$\ln(z_h/z_0)\f$
+ *  @param Tflux Kinematic surface heat flux
+ *  @param Lfac  Obukhov length scaling, L = utau^3 * Lfac
+ *  @param converged 1.0 for lanes whose solution converged within NumIters
+ *                   iterations or did not need the iteration, 0.0 otherwise
+ */
+template<int NumIters = 40, typename T>
+KOKKOS_FUNCTION
+T friction_velocity(
+  const T& uh,
+  const T& zh,
+  const T& term1,
+  const T& Tflux,
+  const T& Lfac,
+  const T& kappa,
+  const T& beta_m,
+  const T& gamma_m,
+  T& converged)
+{
+  const double eps = 1.0e-8;
+  const double convTol = 1.0e-7;
+  const double perturb = 1.0e-3;
+
+  const T utauNeutral = kappa * uh / term1;
+  const T sgnq = stk::math::if_then_else((Tflux > 0.0), T(1.0), T(-1.0));
+
+  T utau0 = stk::math::if_then_else((Tflux > 0.0), 3.0 * utauNeutral, utauNeutral);
+  T utau1 = (1.0 + perturb) * utau0;
+  T utau = utau0;
+  // Converged flag per lane (1.0 = converged)
+  T done = 0.0;
+
+  for (int k=0; k < NumIters; ++k) {
+    const T L0 = -sgnq * stk::math::max(
+      T(1.0e-10), stk::math::abs(utau0 * utau0 * utau0 * Lfac));
+    const T L1 = -sgnq * stk::math::max(
+      T(1.1e-10), stk::math::abs(utau1 * utau1 * utau1 * Lfac));
+
+    const T denom0 = term1 - psim(zh / L0, Tflux, beta_m, gamma_m);
+    const T denom1 = term1 - psim(zh / L1, Tflux, beta_m, gamma_m);
+
+    const T f0 = utau0 - uh * kappa / denom0;
+    const T f1 = utau1 - uh * kappa / denom1;
+
+    T dutau = utau1 - utau0;
+    dutau = stk::math::if_then_else(
+      (dutau > 0.0), stk::math::max(T(1.0e-15), dutau),
+      stk::math::min(T(-1.0e-15), dutau));
+
+    T fprime = (f1 - f0) / dutau;
+    fprime = stk::math::if_then_else(
+      (fprime > 0.0), stk::math::max(T(1.0e-15), fprime),
+      stk::math::min(T(-1.0e-15), fprime));
+
+    const T utauNew = utau0 - f0 / fprime;
+
+    // Record the solution for lanes converging in this iteration
+    const T newlyDone = stk::math::if_then_else(
+      (done < 0.5) && (stk::math::abs(f1) < convTol), T(1.0), T(0.0));
+    utau = stk::math::if_then_else(
+      (newlyDone > 0.5), stk::math::max(T(0.0), utauNew), utau);
+    done = done + newlyDone;
+
+    // Only advance lanes that are still iterating
+    const T active = stk::math::if_then_else((done < 0.5), T(1.0), T(0.0));
+    utau = stk::math::if_then_else(
+      (active > 0.5), stk::math::max(T(0.0), utauNew), utau);
+    utau0 = stk::math::if_then_else((active > 0.5), utau1, utau0);
+    utau1 = stk::math::if_then_else((active > 0.5), utauNew, utau1);
+  }
+
+  // Neutral stratification and zero velocity lanes
+  const T stratified = stk::math::if_then_else(
+    (stk::math::abs(Tflux) > eps), T(1.0), T(0.0));
+  converged = stk::math::if_then_else(
+    (stratified > 0.5) && (stk::math::abs(uh) >= eps), done, T(1.0));
+
+  utau = stk::math::if_then_else((stk::math::abs(uh) < eps), T(eps), utau);
+  return stk::math::if_then_else((stratified > 0.5), utau, utauNeutral);
+}
+
+//! Friction velocity without the convergence status
+template<int NumIters = 40, typename T>
+KOKKOS_FUNCTION
+T friction_velocity(
+  const T& uh,
+  const T& zh,
+  const T& term1,
+  const T& Tflux,
+  const T& Lfac,
+  const T& kappa,
+  const T& beta_m,
+  const T& gamma_m)
+{
+  T converged = 0.0;
+  return friction_velocity<NumIters>(
+    uh, zh, term1, Tflux, Lfac, kappa, beta_m, gamma_m, converged);
+}
+
 }
 }  // nalu
 }  // sierra